@@ -2,6 +2,7 @@
 #include "Items/Childs/EquipableMaster.h"
 #include "ItemEnums.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 // Sets default values
 AEquipableMaster::AEquipableMaster()
@@ -30,11 +31,46 @@ void AEquipableMaster::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     
-	// Register our properties for replication
-	DOREPLIFETIME(AEquipableMaster, EquipableSocketName);
-	DOREPLIFETIME(AEquipableMaster, AnimationState);
-	DOREPLIFETIME(AEquipableMaster, bIsTwoHanded);
-	DOREPLIFETIME(AEquipableMaster, TwoHandedSocketName);
+	// Push based: only compared after a setter marked them dirty
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AEquipableMaster, EquipableSocketName, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AEquipableMaster, AnimationState, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AEquipableMaster, bIsTwoHanded, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AEquipableMaster, TwoHandedSocketName, Params);
+}
+
+void AEquipableMaster::SetEquipableSocketName(const FName NewSocketName)
+{
+	if (EquipableSocketName != NewSocketName)
+	{
+		EquipableSocketName = NewSocketName;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AEquipableMaster, EquipableSocketName, this);
+	}
+}
+
+void AEquipableMaster::SetAnimationState(const E_EquipableAnimationStates NewAnimationState)
+{
+	if (AnimationState != NewAnimationState)
+	{
+		AnimationState = NewAnimationState;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AEquipableMaster, AnimationState, this);
+	}
+}
+
+void AEquipableMaster::SetTwoHanded(const bool bNewIsTwoHanded, const FName NewTwoHandedSocketName)
+{
+	if (bIsTwoHanded != bNewIsTwoHanded)
+	{
+		bIsTwoHanded = bNewIsTwoHanded;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AEquipableMaster, bIsTwoHanded, this);
+	}
+
+	if (TwoHandedSocketName != NewTwoHandedSocketName)
+	{
+		TwoHandedSocketName = NewTwoHandedSocketName;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AEquipableMaster, TwoHandedSocketName, this);
+	}
 }
 
 void AEquipableMaster::GetEquipableInfo_Implementation(FName& OutSocketName, 
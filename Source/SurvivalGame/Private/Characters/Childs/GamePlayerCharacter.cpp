@@ -1,6 +1,8 @@
 // GamePlayerCharacter.cpp
 
 #include "Characters/Childs/GamePlayerCharacter.h"
+#include "Core/SurvivalLog.h"
+#include "Core/SurvivalPlayerController.h"
 #include "Components/Inventory/ItemContainerBase.h"
 #include "Components/Inventory/Child/PlayerInventory.h"
 #include "Interfaces/ControllerInterface.h"
@@ -20,6 +22,10 @@ AGamePlayerCharacter::AGamePlayerCharacter()
     // Create and set up the hotbar component
     PlayerHotbar = CreateDefaultSubobject<UPlayerHotbarComponent>(TEXT("PlayerHotbar"));
     PlayerHotbar->SetIsReplicated(true);
+
+    // The inventory restricts who receives it through net condition groups, which need the
+    // registered list. Both components are replicated components, so the actor registers them itself.
+    bReplicateUsingRegisteredSubObjectList = true;
 }
 
 // Called when the game starts or when spawned
@@ -32,6 +38,15 @@ void AGamePlayerCharacter::BeginPlay()
 void AGamePlayerCharacter::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
+
+    if (HasAuthority())
+    {
+        DispatchMoveCommands();
+    }
+    else if (!OutgoingMoveCommands.IsEmpty())
+    {
+        FlushMoveCommands();
+    }
 }
 
 // Called to bind functionality to input
@@ -45,95 +60,219 @@ void AGamePlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInpu
 void AGamePlayerCharacter::OnSlotDrop_Implementation(int32 DroppedIndex, int32 FromIndex,
     E_ContainerType TargetContainer, E_ContainerType FromContainerType, E_ArmorType ArmorType)
 {
-    UE_LOG(LogTemp, Log, TEXT("OnSlotDrop_Implementation: DroppedIndex=%d, FromIndex=%d, TargetCont=%d, FromCont=%d"),
+    UE_LOG(LogInventory, Verbose, TEXT("OnSlotDrop_Implementation: DroppedIndex=%d, FromIndex=%d, TargetCont=%d, FromCont=%d"),
         DroppedIndex, FromIndex, (int)TargetContainer, (int)FromContainerType);
     
-    // Call the server RPC
-    Server_SlotDrop(DroppedIndex, FromIndex, TargetContainer, FromContainerType, ArmorType);
+    FSlotMoveCommand Command;
+    Command.FromContainer = FromContainerType;
+    Command.ToContainer = TargetContainer;
+    Command.FromIndex = FromIndex;
+    Command.ToIndex = DroppedIndex;
+
+    QueueMoveCommand(Command);
 }
 
-// Server RPC validation
-bool AGamePlayerCharacter::Server_SlotDrop_Validate(int32 DroppedIndex, int32 FromIndex, 
-                                                 E_ContainerType TargetContainer, 
-                                                 E_ContainerType FromContainer,
-                                                 E_ArmorType ArmorType)
+// Main processing function for slot drop operations
+void AGamePlayerCharacter::ProcessSlotDrop(int32 DroppedIndex,
+                                         int32 FromIndex,
+                                         E_ContainerType TargetContainer,
+                                         E_ContainerType FromContainer,
+                                         E_ArmorType ArmorType)
 {
-    // Validate input parameters
-    if (DroppedIndex < 0 || FromIndex < 0)
+    if (!HasAuthority())
+    {
+        UE_LOG(LogInventory, Warning, TEXT("ProcessSlotDrop: Called on a client, use OnSlotDrop instead"));
+        return;
+    }
+
+    FSlotMoveCommand Command;
+    Command.FromContainer = FromContainer;
+    Command.ToContainer = TargetContainer;
+    Command.FromIndex = FromIndex;
+    Command.ToIndex = DroppedIndex;
+
+    ExecuteMoveCommand(Command);
+}
+
+// ================================= Move Commands ================================= 
+void AGamePlayerCharacter::QueueMoveCommand(const FSlotMoveCommand& Command)
+{
+    if (!Command.IsWellFormed())
+    {
+        UE_LOG(LogInventory, Warning, TEXT("QueueMoveCommand: Dropping malformed move %d[%d] -> %d[%d] x%d"),
+            (int)Command.FromContainer, Command.FromIndex, (int)Command.ToContainer, Command.ToIndex, Command.Quantity);
+        return;
+    }
+
+    if (HasAuthority())
+    {
+        PendingMoveCommands.Add(Command);
+        return;
+    }
+
+    if (!IsLocallyControlled())
+    {
+        return;
+    }
+
+    // Show the move right away; the server's answer confirms or rolls it back.
+    // Link changes on a linked hotbar move no items and show up when the links replicate.
+    FSlotMoveCommand& Queued = OutgoingMoveCommands.Add_GetRef(Command);
+    if (IsLinkedHotbarMove(Command))
+    {
+        return;
+    }
+
+    if (ASurvivalPlayerController* PlayerController = Cast<ASurvivalPlayerController>(GetController()))
+    {
+        Queued.PredictionKey = PlayerController->PredictSlotMove(Command,
+            FindContainerByType(Command.FromContainer), FindContainerByType(Command.ToContainer));
+    }
+}
+
+void AGamePlayerCharacter::FlushMoveCommands()
+{
+    const int32 NumToSend = FMath::Min(OutgoingMoveCommands.Num(), MaxMoveCommandsPerBatch);
+    if (NumToSend == OutgoingMoveCommands.Num())
+    {
+        Server_SubmitMoveCommands(OutgoingMoveCommands);
+        OutgoingMoveCommands.Reset();
+        return;
+    }
+
+    // A burst larger than one batch spills over into the following frames
+    Server_SubmitMoveCommands(TArray<FSlotMoveCommand>(OutgoingMoveCommands.GetData(), NumToSend));
+    OutgoingMoveCommands.RemoveAt(0, NumToSend, EAllowShrinking::No);
+}
+
+bool AGamePlayerCharacter::Server_SubmitMoveCommands_Validate(const TArray<FSlotMoveCommand>& Commands)
+{
+    // QueueMoveCommand never sends malformed commands, so one arriving means a tampered client
+    return Commands.Num() <= MaxMoveCommandsPerBatch
+        && !Commands.ContainsByPredicate([](const FSlotMoveCommand& Command) { return !Command.IsWellFormed(); });
+}
+
+void AGamePlayerCharacter::Server_SubmitMoveCommands_Implementation(const TArray<FSlotMoveCommand>& Commands)
+{
+    if (PendingMoveCommands.Num() + Commands.Num() > MaxPendingMoveCommands)
+    {
+        SURVIVAL_LOG_RATELIMITED(LogInventory, Warning, 1.0, TEXT("Server_SubmitMoveCommands: %s has %d moves pending, dropping %d"),
+            *GetName(), PendingMoveCommands.Num(), Commands.Num());
+
+        // Dropped moves still need an answer or the client keeps showing them
+        for (const FSlotMoveCommand& Command : Commands)
+        {
+            AcknowledgeMoveCommand(Command, false);
+        }
+        return;
+    }
+
+    PendingMoveCommands.Append(Commands);
+}
+
+void AGamePlayerCharacter::DispatchMoveCommands()
+{
+    if (PendingMoveCommands.IsEmpty())
+    {
+        return;
+    }
+
+    const int32 NumToRun = FMath::Min(PendingMoveCommands.Num(), MaxMoveCommandsPerTick);
+    for (int32 Index = 0; Index < NumToRun; ++Index)
+    {
+        const FSlotMoveCommand& Command = PendingMoveCommands[Index];
+        AcknowledgeMoveCommand(Command, ExecuteMoveCommand(Command));
+    }
+
+    PendingMoveCommands.RemoveAt(0, NumToRun, EAllowShrinking::No);
+}
+
+bool AGamePlayerCharacter::ExecuteMoveCommand(const FSlotMoveCommand& Command)
+{
+    UE_LOG(LogInventory, Verbose, TEXT("ExecuteMoveCommand: From=%d[%d], To=%d[%d], Quantity=%d"),
+        (int)Command.FromContainer, Command.FromIndex, (int)Command.ToContainer, Command.ToIndex, Command.Quantity);
+
+    if (!Command.IsWellFormed())
     {
         return false;
     }
-    
-    // Check if container types are valid
-    if (TargetContainer == E_ContainerType::None || FromContainer == E_ContainerType::None)
+
+    if (IsLinkedHotbarMove(Command))
+    {
+        return PlayerHotbar->ApplyLinkMove(Command);
+    }
+
+    UItemContainerBase* FromContainer = FindContainerByType(Command.FromContainer);
+    UItemContainerBase* ToContainer = FindContainerByType(Command.ToContainer);
+    if (!FromContainer || !ToContainer)
     {
+        SURVIVAL_LOG_RATELIMITED(LogInventory, Warning, 1.0, TEXT("ExecuteMoveCommand: %s has no container for type %d or %d"),
+            *GetName(), (int)Command.FromContainer, (int)Command.ToContainer);
         return false;
     }
-    
-    return true;
+
+    if (!FromContainer->Items.IsValidIndex(Command.FromIndex) || !ToContainer->Items.IsValidIndex(Command.ToIndex))
+    {
+        SURVIVAL_LOG_RATELIMITED(LogInventory, Warning, 1.0, TEXT("ExecuteMoveCommand: Slot out of range (%d -> %d)"),
+            Command.FromIndex, Command.ToIndex);
+        return false;
+    }
+
+    const FItemStructure SourceItem = FromContainer->GetItemAtIndex(Command.FromIndex);
+    if (SourceItem.IsEmpty() || Command.Quantity > SourceItem.ItemQuantity)
+    {
+        // Usually an earlier command in the same batch already moved the stack
+        UE_LOG(LogInventory, Verbose, TEXT("ExecuteMoveCommand: Source slot %d no longer holds what was dragged"), Command.FromIndex);
+        return false;
+    }
+
+    if (Command.Quantity > 0 && Command.Quantity < SourceItem.ItemQuantity)
+    {
+        return FromContainer->TransferItemQuantity(ToContainer, Command.ToIndex, Command.FromIndex, Command.Quantity);
+    }
+
+    // Rejected moves are acked as such so the client rolls its prediction back
+    return FromContainer->TransferItem(ToContainer, Command.ToIndex, Command.FromIndex);
 }
 
-// Server RPC implementation
-void AGamePlayerCharacter::Server_SlotDrop_Implementation(int32 DroppedIndex, int32 FromIndex, 
-                                                       E_ContainerType TargetContainer, 
-                                                       E_ContainerType FromContainer,
-                                                       E_ArmorType ArmorType)
+bool AGamePlayerCharacter::IsLinkedHotbarMove(const FSlotMoveCommand& Command) const
 {
-    UE_LOG(LogTemp, Log, TEXT("Server_SlotDrop_Implementation: DroppedIndex=%d, FromIndex=%d, TargetCont=%d, FromCont=%d"),
-        DroppedIndex, FromIndex, (int)TargetContainer, (int)FromContainer);
-    
-    // Call the processing function with the CORRECT parameter order
-    ProcessSlotDrop(DroppedIndex, FromIndex, TargetContainer, FromContainer, ArmorType);
+    return PlayerHotbar && PlayerHotbar->IsLinkedView()
+        && (Command.FromContainer == E_ContainerType::Hotbar || Command.ToContainer == E_ContainerType::Hotbar);
 }
 
-// Main processing function for slot drop operations
-void AGamePlayerCharacter::ProcessSlotDrop(int32 DroppedIndex,
-                                         int32 FromIndex,
-                                         E_ContainerType TargetContainer,
-                                         E_ContainerType FromContainer,
-                                         E_ArmorType ArmorType)
+void AGamePlayerCharacter::AcknowledgeMoveCommand(const FSlotMoveCommand& Command, const bool bAccepted) const
 {
-    UE_LOG(LogTemp, Log, TEXT("ProcessSlotDrop: DroppedIndex=%d, FromIndex=%d, TargetCont=%d, FromCont=%d"),
-        DroppedIndex, FromIndex, (int)TargetContainer, (int)FromContainer);
-    
-    // Get target container component - currently only supporting Inventory
-    UPlayerInventory* TargetContainerComp = nullptr;
-    if (TargetContainer == E_ContainerType::Inventory)
+    if (Command.PredictionKey <= 0)
     {
-        TargetContainerComp = PlayerInventory;
+        return;
     }
-    
-    // Get source container component - currently only supporting Inventory
-    UPlayerInventory* FromContainerComp = nullptr;
-    if (FromContainer == E_ContainerType::Inventory)
+
+    if (ASurvivalPlayerController* PlayerController = Cast<ASurvivalPlayerController>(GetController()))
     {
-        FromContainerComp = PlayerInventory;
+        PlayerController->AcknowledgeSlotMove(Command.PredictionKey, bAccepted);
     }
-    
-    // Check if both container components are valid
-    if (IsValid(TargetContainerComp) && IsValid(FromContainerComp))
-    {
-        // Cast to base container types
-        UItemContainerBase* BaseTargetContainer = Cast<UItemContainerBase>(TargetContainerComp);
-        UItemContainerBase* BaseFromContainer = Cast<UItemContainerBase>(FromContainerComp);
-        
-        if (BaseTargetContainer && BaseFromContainer)
-        {
-            UE_LOG(LogTemp, Log, TEXT("ProcessSlotDrop: About to call OnSlotDrop with BaseFromContainer=%p, FromIndex=%d, DroppedIndex=%d"),
-                BaseFromContainer, FromIndex, DroppedIndex);
-            
-            BaseTargetContainer->OnSlotDrop(BaseFromContainer, FromIndex, DroppedIndex);
-        }
-        else
+}
+
+UItemContainerBase* AGamePlayerCharacter::FindContainerByType(const E_ContainerType ContainerType) const
+{
+    switch (ContainerType)
+    {
+        case E_ContainerType::Inventory:
+            return PlayerInventory;
+
+        case E_ContainerType::Hotbar:
+            return PlayerHotbar;
+
+        case E_ContainerType::Storage:
+        case E_ContainerType::AICompanion:
         {
-            UE_LOG(LogTemp, Error, TEXT("ProcessSlotDrop: Failed to cast to base container class"));
+            const ASurvivalPlayerController* PlayerController = Cast<ASurvivalPlayerController>(GetController());
+            return PlayerController ? PlayerController->FindOpenContainer(ContainerType) : nullptr;
         }
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("ProcessSlotDrop: Invalid container references. Target: %s, From: %s"),
-            TargetContainerComp ? TEXT("Valid") : TEXT("Invalid"),
-            FromContainerComp ? TEXT("Valid") : TEXT("Invalid"));
+
+        default:
+            return nullptr;
     }
 }
 
@@ -43,4 +43,15 @@ void AGameBaseCharacter::UpdateItem_Implementation(E_ContainerType ContainerType
 		// Call the UpdateItemSlot method on the controller through the interface
 		IControllerInterface::Execute_UpdateItemSlot(PlayerController, ContainerType, ItemInfo, Index);
 	}
+}
+
+void AGameBaseCharacter::UpdateItems_Implementation(E_ContainerType ContainerType, const TArray<FItemSlotUpdate>& SlotUpdates)
+{
+	AController* PlayerController = GetController();
+
+	// Forward the whole change set so the controller can send it in one RPC
+	if (PlayerController && PlayerController->Implements<UControllerInterface>())
+	{
+		IControllerInterface::Execute_UpdateItemSlots(PlayerController, ContainerType, SlotUpdates);
+	}
 }
\ No newline at end of file
@@ -1,20 +1,293 @@
 #include "Components/Inventory/Child/PlayerHotbarComponent.h"
+#include "Components/Inventory/SlotMoveCommand.h"
+#include "Core/SurvivalLog.h"
+#include "GameFramework/Pawn.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "Net/UnrealNetwork.h"
 
+//===========================================FHotbarSlotLink====================================================
+bool FHotbarSlotLink::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 Container = static_cast<uint8>(SourceContainer);
+	Ar << Container;
+
+	// Shifted by one so an unlinked slot packs as 0
+	uint32 PackedIndex = static_cast<uint32>(FMath::Max(SourceIndex + 1, 0));
+	Ar.SerializeIntPacked(PackedIndex);
+
+	if (Ar.IsLoading())
+	{
+		if (Container > static_cast<uint8>(E_ContainerType::Hidden) || PackedIndex > MAX_int32)
+		{
+			bOutSuccess = false;
+			return false;
+		}
+
+		SourceContainer = static_cast<E_ContainerType>(Container);
+		SourceIndex = static_cast<int32>(PackedIndex) - 1;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return bOutSuccess;
+}
+
+//===========================================UPlayerHotbarComponent====================================================
 UPlayerHotbarComponent::UPlayerHotbarComponent()
 {
 	// Set default values
 	ContainerType = E_ContainerType::Hotbar;
 	MaxSlots = 8;
-    
-	// Set component properties
-	PrimaryComponentTick.bCanEverTick = false;
+	bLinkedView = false;
+
+	// Set component properties (tick is managed by the base class for change notifications)
 	SetIsReplicatedByDefault(true);
 }
 
+void UPlayerHotbarComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	Params.Condition = COND_OwnerOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UPlayerHotbarComponent, Links, Params);
+}
+
+void UPlayerHotbarComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// A linked hotbar's items are local copies of inventory slots the owner already receives
+	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UItemContainerBase, Items, !bLinkedView);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UPlayerHotbarComponent, Links, bLinkedView);
+}
+
 void UPlayerHotbarComponent::BeginPlay()
 {
 	Super::BeginPlay();
-    
-	// You could add hotbar-specific initialization here if needed
-	UE_LOG(LogTemp, Log, TEXT("PlayerHotbarComponent: Initialized with %d slots"), MaxSlots);
-}
\ No newline at end of file
+
+	if (bLinkedView)
+	{
+		TInlineComponentArray<UItemContainerBase*> Containers(GetOwner());
+		for (UItemContainerBase* Container : Containers)
+		{
+			if (Container != this && Container->ContainerType == E_ContainerType::Inventory)
+			{
+				LinkSource = Container;
+				Container->OnSlotChanged.AddUniqueDynamic(this, &UPlayerHotbarComponent::HandleSourceSlotChanged);
+
+				// Links are authored on the server; clients get the remapped links through replication
+				if (GetOwnerRole() == ROLE_Authority)
+				{
+					Container->OnSlotsMoved.AddUObject(this, &UPlayerHotbarComponent::HandleSourceSlotsMoved);
+				}
+				break;
+			}
+		}
+
+		if (!LinkSource.IsValid())
+		{
+			UE_LOG(LogInventory, Warning, TEXT("PlayerHotbarComponent: Linked view but %s has no inventory to link to"), *GetNameSafe(GetOwner()));
+		}
+
+		// Links may have arrived before the inventory was bound
+		for (int32 HotbarIndex = 0; HotbarIndex < Links.Num(); ++HotbarIndex)
+		{
+			RefreshLinkedSlot(HotbarIndex);
+		}
+	}
+
+	UE_LOG(LogInventory, Verbose, TEXT("PlayerHotbarComponent: Initialized with %d slots%s"), MaxSlots, bLinkedView ? TEXT(" (linked view)") : TEXT(""));
+}
+
+void UPlayerHotbarComponent::InitializeContainer()
+{
+	if (!bLinkedView)
+	{
+		Super::InitializeContainer();
+		return;
+	}
+
+	// Every machine builds its own slots; only the links come from the server
+	ResetSlotState(MaxSlots);
+
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		Links.Init(FHotbarSlotLink(), MaxSlots);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UPlayerHotbarComponent, Links, this);
+	}
+}
+
+//===========================================Links====================================================
+void UPlayerHotbarComponent::LinkSlot(const int32 HotbarIndex, const int32 InventoryIndex)
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		Server_LinkSlot(HotbarIndex, InventoryIndex);
+		return;
+	}
+
+	if (!bLinkedView || !Links.IsValidIndex(HotbarIndex))
+	{
+		return;
+	}
+
+	// Only occupied slots can be put on the bar; clearing is always allowed
+	if (InventoryIndex != INDEX_NONE && (!LinkSource.IsValid() || LinkSource->IsSlotEmpty(InventoryIndex)))
+	{
+		UE_LOG(LogInventory, Verbose, TEXT("LinkSlot: Inventory slot %d is empty"), InventoryIndex);
+		return;
+	}
+
+	SetLink(HotbarIndex, InventoryIndex);
+}
+
+void UPlayerHotbarComponent::Server_LinkSlot_Implementation(const int32 HotbarIndex, const int32 InventoryIndex)
+{
+	LinkSlot(HotbarIndex, InventoryIndex);
+}
+
+int32 UPlayerHotbarComponent::GetLinkedSlot(const int32 HotbarIndex) const
+{
+	return Links.IsValidIndex(HotbarIndex) && Links[HotbarIndex].IsLinked() ? Links[HotbarIndex].SourceIndex : INDEX_NONE;
+}
+
+bool UPlayerHotbarComponent::ApplyLinkMove(const FSlotMoveCommand& Command)
+{
+	if (!bLinkedView || GetOwnerRole() != ROLE_Authority)
+	{
+		return false;
+	}
+
+	if (Command.ToContainer == E_ContainerType::Hotbar)
+	{
+		if (!Links.IsValidIndex(Command.ToIndex))
+		{
+			return false;
+		}
+
+		// Rearranging the bar swaps the two references
+		if (Command.FromContainer == E_ContainerType::Hotbar)
+		{
+			if (!Links.IsValidIndex(Command.FromIndex) || Command.FromIndex == Command.ToIndex)
+			{
+				return false;
+			}
+
+			const int32 FromLink = GetLinkedSlot(Command.FromIndex);
+			SetLink(Command.FromIndex, GetLinkedSlot(Command.ToIndex));
+			SetLink(Command.ToIndex, FromLink);
+			return true;
+		}
+
+		if (Command.FromContainer != E_ContainerType::Inventory || !LinkSource.IsValid() || LinkSource->IsSlotEmpty(Command.FromIndex))
+		{
+			return false;
+		}
+
+		SetLink(Command.ToIndex, Command.FromIndex);
+		return true;
+	}
+
+	// Dragged off the bar: the item never left the inventory, so only the reference goes
+	if (Command.FromContainer == E_ContainerType::Hotbar && Links.IsValidIndex(Command.FromIndex))
+	{
+		SetLink(Command.FromIndex, INDEX_NONE);
+		return true;
+	}
+
+	return false;
+}
+
+void UPlayerHotbarComponent::SetLink(const int32 HotbarIndex, const int32 InventoryIndex)
+{
+	FHotbarSlotLink NewLink;
+	if (InventoryIndex != INDEX_NONE)
+	{
+		NewLink.SourceContainer = E_ContainerType::Inventory;
+		NewLink.SourceIndex = InventoryIndex;
+	}
+
+	if (Links[HotbarIndex] == NewLink)
+	{
+		return;
+	}
+
+	Links[HotbarIndex] = NewLink;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UPlayerHotbarComponent, Links, this);
+	RefreshLinkedSlot(HotbarIndex);
+}
+
+void UPlayerHotbarComponent::OnRep_Links()
+{
+	// Eight entries; rewriting the unchanged ones is cheaper than diffing them
+	for (int32 HotbarIndex = 0; HotbarIndex < Links.Num(); ++HotbarIndex)
+	{
+		RefreshLinkedSlot(HotbarIndex);
+	}
+}
+
+void UPlayerHotbarComponent::HandleSourceSlotChanged(const int32 SlotIndex, const FItemStructure& Item)
+{
+	// An item that was used up or removed takes its links with it, or the next item put into the
+	// slot would show up on the bar. Moves remap links through OnSlotsMoved before this runs.
+	const bool bClearLinks = GetOwnerRole() == ROLE_Authority && LinkSource.IsValid() && LinkSource->IsSlotEmpty(SlotIndex);
+
+	for (int32 HotbarIndex = 0; HotbarIndex < Links.Num(); ++HotbarIndex)
+	{
+		if (Links[HotbarIndex].SourceIndex == SlotIndex && Links[HotbarIndex].IsLinked())
+		{
+			if (bClearLinks)
+			{
+				SetLink(HotbarIndex, INDEX_NONE);
+			}
+			else
+			{
+				RefreshLinkedSlot(HotbarIndex);
+			}
+		}
+	}
+}
+
+void UPlayerHotbarComponent::HandleSourceSlotsMoved(const TMap<int32, int32>& OldToNewSlot)
+{
+	// Read every old link before writing any, so swapped slots don't remap twice
+	TArray<int32, TInlineAllocator<8>> NewLinks;
+	NewLinks.SetNumUninitialized(Links.Num());
+	for (int32 HotbarIndex = 0; HotbarIndex < Links.Num(); ++HotbarIndex)
+	{
+		const int32 LinkedSlot = GetLinkedSlot(HotbarIndex);
+		const int32* NewSlot = LinkedSlot != INDEX_NONE ? OldToNewSlot.Find(LinkedSlot) : nullptr;
+		NewLinks[HotbarIndex] = NewSlot ? *NewSlot : LinkedSlot;
+	}
+
+	for (int32 HotbarIndex = 0; HotbarIndex < Links.Num(); ++HotbarIndex)
+	{
+		SetLink(HotbarIndex, NewLinks[HotbarIndex]);
+	}
+}
+
+void UPlayerHotbarComponent::RefreshLinkedSlot(const int32 HotbarIndex)
+{
+	if (!Items.IsValidIndex(HotbarIndex) || !Links.IsValidIndex(HotbarIndex))
+	{
+		return;
+	}
+
+	const FHotbarSlotLink& Link = Links[HotbarIndex];
+	const FItemStructure Item = Link.IsLinked() && LinkSource.IsValid() ? LinkSource->GetItemAtIndex(Link.SourceIndex) : FItemStructure();
+
+	// Local copy only: Items and its replication are left alone
+	WriteSlotStore(HotbarIndex, Item);
+	UpdateOccupancy(HotbarIndex, Item);
+
+	// Widgets live with the local player. On a client the notification goes through the
+	// controller's outbox, which shows it directly since Client_ApplySlotUpdates runs locally there.
+	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	if (OwnerPawn && OwnerPawn->IsLocallyControlled())
+	{
+		MarkSlotDirty(HotbarIndex);
+	}
+
+	OnSlotChanged.Broadcast(HotbarIndex, Item);
+}
@@ -0,0 +1,173 @@
+// StorageContainer.cpp
+
+#include "Components/Inventory/Child/StorageContainer.h"
+
+#include "Core/StorageSubsystem.h"
+#include "Core/SurvivalLog.h"
+#include "Engine/World.h"
+
+UStorageContainer::UStorageContainer()
+{
+    ContainerType = E_ContainerType::Storage;
+
+    // Nearby players only receive a chest's contents once they open it
+    bViewerScopedReplication = true;
+}
+
+void UStorageContainer::InitializeContainer()
+{
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    OnSlotChanged.AddUniqueDynamic(this, &UStorageContainer::HandleStorageSlotChanged);
+    EnsureStorageId();
+
+    if (UStorageSubsystem* Storage = GetStorageSubsystem())
+    {
+        Storage->RegisterStorage(this);
+        return;
+    }
+
+    // No subsystem (e.g. client-only world): behave like a plain container
+    Super::InitializeContainer();
+    bResident = true;
+}
+
+void UStorageContainer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UStorageSubsystem* Storage = GetStorageSubsystem())
+    {
+        Storage->UnregisterStorage(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void UStorageContainer::OnRegister()
+{
+    Super::OnRegister();
+
+    // Placed chests get their id in the editor so it is saved with the level
+    const UWorld* World = GetWorld();
+    if (!StorageId.IsValid() && !IsTemplate() && World && World->WorldType == EWorldType::Editor)
+    {
+        Modify();
+        StorageId = FGuid::NewGuid();
+    }
+}
+
+void UStorageContainer::PostEditImport()
+{
+    Super::PostEditImport();
+
+    // A pasted chest is a new chest, not a second view of the copied one
+    StorageId = FGuid::NewGuid();
+}
+
+void UStorageContainer::PostDuplicate(const bool bDuplicateForPIE)
+{
+    Super::PostDuplicate(bDuplicateForPIE);
+
+    if (!bDuplicateForPIE)
+    {
+        StorageId = FGuid::NewGuid();
+    }
+}
+#endif
+
+void UStorageContainer::EnsureStorageId()
+{
+    if (StorageId.IsValid())
+    {
+        return;
+    }
+
+    // A chest loaded with its level keeps the same path every session, and so the same id
+    const AActor* Owner = GetOwner();
+    if (Owner && Owner->IsNetStartupActor())
+    {
+        StorageId = FGuid::NewDeterministicGuid(UWorld::RemovePIEPrefix(GetPathName()));
+        return;
+    }
+
+    StorageId = FGuid::NewGuid();
+    UE_LOG(LogInventory, Warning, TEXT("UStorageContainer: %s was spawned without a StorageId; its contents only persist if the save game keeps %s"),
+        *GetNameSafe(Owner), *StorageId.ToString());
+}
+
+bool UStorageContainer::EnsureResident()
+{
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        return false;
+    }
+
+    UStorageSubsystem* Storage = GetStorageSubsystem();
+    return Storage ? Storage->AcquireStorage(this) : bResident;
+}
+
+void UStorageContainer::PrepareSlotAccess() const
+{
+    // Reads page in too, otherwise a query on a paged-out chest would see it empty.
+    // Paging in only replaces the slot state behind the same contents, so const callers are fine.
+    if (!bResident && !bRestoring)
+    {
+        const_cast<UStorageContainer*>(this)->EnsureResident();
+    }
+}
+
+void UStorageContainer::AddViewer(APlayerController* Viewer)
+{
+    if (EnsureResident())
+    {
+        Super::AddViewer(Viewer);
+    }
+}
+
+bool UStorageContainer::Materialize(const TConstArrayView<uint8> Snapshot)
+{
+    TGuardValue<bool> RestoreGuard(bRestoring, true);
+
+    Super::InitializeContainer();
+
+    // Stays paged out on failure, so nothing is written over the contents that failed to load
+    if (!Snapshot.IsEmpty() && !LoadSnapshot(Snapshot))
+    {
+        ResetSlotState(0);
+        return false;
+    }
+
+    bResident = true;
+    return true;
+}
+
+void UStorageContainer::PageOut(TArray<uint8>& OutSnapshot)
+{
+    OutSnapshot.Reset();
+    SaveSnapshot(OutSnapshot);
+
+    ResetSlotState(0);
+    bResident = false;
+}
+
+void UStorageContainer::HandleStorageSlotChanged(int32 SlotIndex, const FItemStructure& Item)
+{
+    if (bRestoring)
+    {
+        return;
+    }
+
+    if (UStorageSubsystem* Storage = GetStorageSubsystem())
+    {
+        Storage->MarkStorageDirty(this);
+    }
+}
+
+UStorageSubsystem* UStorageContainer::GetStorageSubsystem() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UStorageSubsystem>() : nullptr;
+}
@@ -2,16 +2,25 @@
 
 #include "Components/Inventory/ItemContainerBase.h"
 
-#include "Engine/AssetManager.h"
-#include "Engine/ObjectLibrary.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Components/Inventory/ItemContainerSnapshot.h"
+#include "Components/Inventory/ItemContainerTransaction.h"
+#include "Core/SurvivalAssetManager.h"
+#include "Core/SurvivalLog.h"
+#include "GameFramework/PlayerController.h"
 #include "Interfaces/PlayerInterface.h"
+#include "Net/Core/Misc/NetConditionGroupManager.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 #include "PrimaryData/ItemInfo.h"
 
 UItemContainerBase::UItemContainerBase()
 {
-    // Disable tick by default for performance
-    PrimaryComponentTick.bCanEverTick = false;
+    // Only ticks while dirty slots are waiting to be sent
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
     
     // Enable replication
     SetIsReplicatedByDefault(true);
@@ -19,14 +28,28 @@ UItemContainerBase::UItemContainerBase()
     // Default configuration
     MaxSlots = 20;
     ContainerType = E_ContainerType::Storage;
+    bViewerScopedReplication = false;
+    MaxWeight = 0.0f;
+    MediumLoadFraction = 0.5f;
+    HeavyLoadFraction = 0.8f;
+}
+
+void UItemContainerBase::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    // Re-point the slot list at this instance after archetype properties were copied in
+    Items.SetOwner(this);
 }
 
 void UItemContainerBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    // Replicate items array to all clients
-    DOREPLIFETIME(UItemContainerBase, Items);
+    // Replicate slot deltas; push based, so only containers that changed are compared
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(UItemContainerBase, Items, Params);
 }
 
 void UItemContainerBase::BeginPlay()
@@ -35,41 +58,72 @@ void UItemContainerBase::BeginPlay()
     
     // Cache owner reference
     OwningActor = GetOwner();
+
+    if (bViewerScopedReplication && GetOwnerRole() == ROLE_Authority)
+    {
+        SetupViewerScopedReplication();
+    }
     
     // Initialize container slots
     InitializeContainer();
 }
 
+void UItemContainerBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (!ViewerNetGroup.IsNone())
+    {
+        for (const TWeakObjectPtr<APlayerController>& Viewer : Viewers)
+        {
+            if (Viewer.IsValid())
+            {
+                Viewer->RemoveFromNetConditionGroup(ViewerNetGroup);
+            }
+        }
+
+        UE::Net::FNetConditionGroupManager::UnregisterSubObjectFromAllGroups(this);
+    }
+
+    Viewers.Reset();
+    Super::EndPlay(EndPlayReason);
+}
+
+void UItemContainerBase::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    FlushDirtySlots();
+}
+
 
 
 
 void UItemContainerBase::DebugContainerState()
 {
-    UE_LOG(LogTemp, Log, TEXT("=== CONTAINER DEBUG: %s ==="), *GetName());
+    UE_LOG(LogInventory, Log, TEXT("=== CONTAINER DEBUG: %s ==="), *GetName());
     
     // Fix the enum value lookup using StaticEnum
     const UEnum* ContainerEnum = StaticEnum<E_ContainerType>();
     if (ContainerEnum)
     {
-        UE_LOG(LogTemp, Log, TEXT("Container type: %s"), *ContainerEnum->GetNameStringByValue(static_cast<uint8>(ContainerType)));
+        UE_LOG(LogInventory, Log, TEXT("Container type: %s"), *ContainerEnum->GetNameStringByValue(static_cast<uint8>(ContainerType)));
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("Container type: %d (enum not found)"), static_cast<uint8>(ContainerType));
+        UE_LOG(LogInventory, Log, TEXT("Container type: %d (enum not found)"), static_cast<uint8>(ContainerType));
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Max slots: %d"), MaxSlots);
-    UE_LOG(LogTemp, Log, TEXT("Current items: %d"), Items.Num());
+    UE_LOG(LogInventory, Log, TEXT("Max slots: %d"), MaxSlots);
+    UE_LOG(LogInventory, Log, TEXT("Current items: %d"), Items.Num());
     
     for (int32 i = 0; i < Items.Num(); i++)
     {
         if (!Items[i].RegistryKey.IsNone())
         {
-            UE_LOG(LogTemp, Log, TEXT("[%d] Item: %s"), i, *Items[i].RegistryKey.ToString());
-            UE_LOG(LogTemp, Log, TEXT("    Asset: %s"), 
+            UE_LOG(LogInventory, Log, TEXT("[%d] Item: %s"), i, *Items[i].RegistryKey.ToString());
+            UE_LOG(LogInventory, Log, TEXT("    Asset: %s"), 
                 !Items[i].ItemAsset.IsNull() ? *Items[i].ItemAsset.ToSoftObjectPath().ToString() : TEXT("NULL"));
-            UE_LOG(LogTemp, Log, TEXT("    Quantity: %d/%d"), Items[i].ItemQuantity, Items[i].StackSize);
-            UE_LOG(LogTemp, Log, TEXT("    HP: %.1f/%.1f"), Items[i].CurrentHP, Items[i].MaxHP);
+            UE_LOG(LogInventory, Log, TEXT("    Quantity: %d/%d"), Items[i].ItemQuantity, Items[i].StackSize);
+            UE_LOG(LogInventory, Log, TEXT("    HP: %.1f/%.1f"), Items[i].CurrentHP, Items[i].MaxHP);
         }
     }
     
@@ -79,25 +133,25 @@ void UItemContainerBase::DebugContainerState()
     {
         TArray<FPrimaryAssetId> ItemIds;
         AssetManager->GetPrimaryAssetIdList(FPrimaryAssetType("Item"), ItemIds);
-        UE_LOG(LogTemp, Log, TEXT("AssetManager knows about %d 'Item' assets"), ItemIds.Num());
+        UE_LOG(LogItemAssets, Log, TEXT("AssetManager knows about %d 'Item' assets"), ItemIds.Num());
         
         // Log first few items for debugging
         const int32 MaxItemsToLog = FMath::Min(ItemIds.Num(), 5);
         for (int32 i = 0; i < MaxItemsToLog; i++)
         {
-            UE_LOG(LogTemp, Log, TEXT("  - Item[%d]: %s"), i, *ItemIds[i].ToString());
+            UE_LOG(LogItemAssets, Log, TEXT("  - Item[%d]: %s"), i, *ItemIds[i].ToString());
             
             // Try to get the asset path
             FSoftObjectPath AssetPath = AssetManager->GetPrimaryAssetPath(ItemIds[i]);
             if (!AssetPath.IsNull())
             {
-                UE_LOG(LogTemp, Log, TEXT("      Path: %s"), *AssetPath.ToString());
+                UE_LOG(LogItemAssets, Log, TEXT("      Path: %s"), *AssetPath.ToString());
             }
         }
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("AssetManager not initialized!"));
+        UE_LOG(LogItemAssets, Error, TEXT("AssetManager not initialized!"));
     }
 }
 
@@ -109,467 +163,1681 @@ void UItemContainerBase::InitializeContainer()
     if (GetOwnerRole() == ROLE_Authority)
     {
         // Initialize with empty slots
-        Items.SetNum(MaxSlots);
-        for (int32 i = 0; i < MaxSlots; ++i)
-        {
-            Items[i] = FItemStructure(); // Creates empty item structure
-        }
+        ResetSlotState(MaxSlots);
     }
 }
 
-//===========================================Server_AddItem====================================================
-void UItemContainerBase::Server_AddItem_Implementation(const FItemStructure& Item)
+void UItemContainerBase::ResetSlotState(const int32 NumSlots)
 {
-    AddItem(Item);
+    Items.Init(this, NumSlots);
+    MARK_PROPERTY_DIRTY_FROM_NAME(UItemContainerBase, Items, this);
+    SlotStore.Init(NumSlots);
+    OccupiedSlots.Init(false, NumSlots);
+    DirtySlots.Init(false, NumSlots);
+    PartialStackSlots.Reset();
+    TotalWeightMilli = 0;
+    BroadcastWeightMilli = 0;
+    CategoryCounts.Reset();
+    WeightClass = E_WeightClass::None;
+    CategorySlots.Reset();
+    TypeSlots.Reset();
+    ItemCounts.Reset();
 }
 
-//===========================================UpdateUI====================================================
+//===========================================Viewers====================================================
+void UItemContainerBase::SetupViewerScopedReplication()
+{
+    AActor* OwnerActor = GetOwner();
+    if (!OwnerActor || !OwnerActor->IsUsingRegisteredSubObjectList())
+    {
+        UE_LOG(LogInventory, Warning, TEXT("%s: Viewer scoped replication needs %s to use the registered subobject list, replicating to everyone"),
+            *GetName(), OwnerActor ? *OwnerActor->GetName() : TEXT("<no owner>"));
+        return;
+    }
 
+    // Unique per component so each container has its own audience
+    ViewerNetGroup = FName(TEXT("ContainerViewers"), static_cast<int32>(GetUniqueID()));
 
-void UItemContainerBase::UpdateUI(const int32 Index, const FItemStructure& ItemInfo)
+    UE::Net::FNetConditionGroupManager::RegisterSubObjectInGroup(this, ViewerNetGroup);
+    UE::Net::FNetConditionGroupManager::RegisterSubObjectInGroup(this, UE::Net::NetGroupOwner);
+    OwnerActor->SetReplicatedComponentNetCondition(this, COND_NetGroup);
+}
+
+void UItemContainerBase::AddViewer(APlayerController* Viewer)
 {
-    AActor* OwnerActor = GetOwner();
-    if (!OwnerActor)
+    if (GetOwnerRole() != ROLE_Authority || !IsValid(Viewer))
     {
-        UE_LOG(LogTemp, Warning, TEXT("UpdateUI: Owner actor is null"));
         return;
     }
-    
-    if (OwnerActor->Implements<UPlayerInterface>())
+
+    Viewers.RemoveAll([](const TWeakObjectPtr<APlayerController>& Existing) { return !Existing.IsValid(); });
+    if (Viewers.Contains(Viewer))
     {
-        // Make sure to use the correct parameter order that matches the interface
-        IPlayerInterface::Execute_UpdateItem(OwnerActor, ContainerType, Index, ItemInfo);
-        UE_LOG(LogTemp, Log, TEXT("UpdateUI: Updated UI for slot %d with item %s"),
-            Index, *ItemInfo.RegistryKey.ToString());
+        return;
     }
-    else
+
+    Viewers.Add(Viewer);
+
+    if (!ViewerNetGroup.IsNone())
     {
-        UE_LOG(LogTemp, Warning, TEXT("UpdateUI: Owner does not implement PlayerInterface"));
+        Viewer->IncludeInNetConditionGroup(ViewerNetGroup);
     }
+
+    UE_LOG(LogInventory, Verbose, TEXT("%s: %s opened the container (%d viewers)"), *GetName(), *Viewer->GetName(), Viewers.Num());
 }
 
-//===========================================FindEmptySlot====================================================
-bool UItemContainerBase::FindEmptySlot(bool& Success, int32& EmptyIndex) const
+void UItemContainerBase::RemoveViewer(APlayerController* Viewer)
 {
-    // Initialize with invalid state
-    Success = false;
-    EmptyIndex = -1;
+    if (GetOwnerRole() != ROLE_Authority || !Viewer)
+    {
+        return;
+    }
 
-    for (int32 Index = 0; Index <Items.Num(); ++Index)
+    if (Viewers.Remove(Viewer) == 0)
     {
-        if (Items[Index].RegistryKey.IsNone())
-        {
-            Success = true;
-            EmptyIndex = Index;
-            break;
-        }
+        return;
     }
 
-    return Success;
+    if (!ViewerNetGroup.IsNone())
+    {
+        Viewer->RemoveFromNetConditionGroup(ViewerNetGroup);
+    }
 
+    UE_LOG(LogInventory, Verbose, TEXT("%s: %s closed the container (%d viewers)"), *GetName(), *Viewer->GetName(), Viewers.Num());
 }
-//===========================================AddItem====================================================
-// In ItemContainerBase.cpp
-bool UItemContainerBase::AddItem(const FItemStructure& Item)
+
+bool UItemContainerBase::HasViewers() const
 {
-    if (GetOwnerRole() != ROLE_Authority)
+    return Viewers.ContainsByPredicate([](const TWeakObjectPtr<APlayerController>& Viewer) { return Viewer.IsValid(); });
+}
+
+bool UItemContainerBase::SendsSlotUpdates() const
+{
+    const AActor* OwnerActor = GetOwner();
+    return OwnerActor && OwnerActor->Implements<UPlayerInterface>();
+}
+
+bool UItemContainerBase::CanOwnerReach(const UItemContainerBase* Target) const
+{
+    if (!IsValid(Target))
     {
-        Server_AddItem(Item);
-        return true;
+        return false;
     }
-    
-    // Create a working copy of the item data
-    FItemStructure LocalItemInfo = Item;
-    
-    // Ensure we have a valid asset reference before proceeding
-    if (LocalItemInfo.ItemAsset.IsNull())
+
+    if (Target->GetOwner() == GetOwner())
     {
-        // If we have a registry key but no asset reference, try to resolve it
-        if (!LocalItemInfo.RegistryKey.IsNone())
-        {
-            UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
-            if (AssetManager)
-            {
-                // Create a primary asset ID using the registry key
-                FPrimaryAssetId ItemId = FPrimaryAssetId(FPrimaryAssetType("Item"), LocalItemInfo.RegistryKey);
-                
-                // Log the attempt for debugging
-                UE_LOG(LogTemp, Log, TEXT("Resolving asset for %s (ID: %s)"), 
-                    *LocalItemInfo.RegistryKey.ToString(), 
-                    *ItemId.ToString());
-                    
-                // Get the path from the asset manager
-                FSoftObjectPath ItemPath = AssetManager->GetPrimaryAssetPath(ItemId);
-                if (!ItemPath.IsNull())
-                {
-                    UE_LOG(LogTemp, Log, TEXT("Successfully resolved path: %s"), *ItemPath.ToString());
-                    LocalItemInfo.ItemAsset = TSoftObjectPtr<UItemInfo>(ItemPath);
-                }
-                else
-                {
-                    // Try to find the asset through direct query if path resolution failed
-                    UObject* ItemObj = AssetManager->GetPrimaryAssetObject(ItemId);
-                    if (ItemObj)
-                    {
-                        UE_LOG(LogTemp, Log, TEXT("Found asset via direct query: %s"), *ItemObj->GetPathName());
-                        LocalItemInfo.ItemAsset = TSoftObjectPtr<UItemInfo>(FSoftObjectPath(ItemObj->GetPathName()));
-                    }
-                    else
-                    {
-                        // Plan B: Try to find the item by searching all UItemInfo assets
-                        
-                        UObjectLibrary* ItemLibrary = UObjectLibrary::CreateLibrary(UItemInfo::StaticClass(), true, true);
-                        ItemLibrary->LoadAssetDataFromPath("/Game/_MAIN/Data");
-                        
-                        TArray<FAssetData> AllItemAssets;
-                        ItemLibrary->GetAssetDataList(AllItemAssets);
-                        
-                        bool bFoundMatch = false;
-                        for (const FAssetData& AssetData : AllItemAssets)
-                        {
-                            UItemInfo* PotentialItem = Cast<UItemInfo>(AssetData.GetAsset());
-                            if (PotentialItem && PotentialItem->RegistryKey == LocalItemInfo.RegistryKey)
-                            {
-                                UE_LOG(LogTemp, Log, TEXT("Found matching item through content search: %s"), 
-                                    *AssetData.GetSoftObjectPath().ToString());
-                                LocalItemInfo.ItemAsset = TSoftObjectPtr<UItemInfo>(AssetData.GetSoftObjectPath());
-                                bFoundMatch = true;
-                                break;
-                            }
-                        }
-                        
-                        if (!bFoundMatch)
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("Failed to resolve asset for key: %s"), 
-                                *LocalItemInfo.RegistryKey.ToString());
-                            
-                            // Log all available Item assets for debugging
-                            TArray<FPrimaryAssetId> AllItems;
-                            AssetManager->GetPrimaryAssetIdList(FPrimaryAssetType("Item"), AllItems);
-                            UE_LOG(LogTemp, Log, TEXT("Available Item assets (%d):"), AllItems.Num());
-                            for (const FPrimaryAssetId& AssetId : AllItems)
-                            {
-                                UE_LOG(LogTemp, Log, TEXT("  - %s"), *AssetId.ToString());
-                            }
-                            
-                            UE_LOG(LogTemp, Log, TEXT("Direct content search found %d potential items:"), AllItemAssets.Num());
-                            for (int32 i = 0; i < FMath::Min(10, AllItemAssets.Num()); i++)
-                            {
-                                UE_LOG(LogTemp, Log, TEXT("  - %s"), *AllItemAssets[i].AssetName.ToString());
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        return true;
     }
-    
-    // Double-check that we now have a valid asset path
-    if (LocalItemInfo.ItemAsset.IsNull())
+
+    // A pawn's net owner is its controller, the same player that opens containers
+    const AActor* OwnerActor = GetOwner();
+    const AActor* Player = OwnerActor ? OwnerActor->GetNetOwner() : nullptr;
+    return Player && Target->Viewers.ContainsByPredicate([Player](const TWeakObjectPtr<APlayerController>& Viewer) { return Viewer.Get() == Player; });
+}
+
+//===========================================SetSlotItem====================================================
+void UItemContainerBase::SetSlotItem(const int32 Index, const FItemStructure& Item)
+{
+    if (!Items.IsValidIndex(Index))
     {
-        UE_LOG(LogTemp, Error, TEXT("Cannot add item with invalid asset reference. RegKey: %s"), 
-            LocalItemInfo.RegistryKey.IsNone() ? TEXT("NONE") : *LocalItemInfo.RegistryKey.ToString());
-        return false;
+        return;
     }
 
-    // Find an empty slot
-    bool Success;
-    int32 LocalEmptyIndex;
-    FindEmptySlot(Success, LocalEmptyIndex);
+    const FItemStructure OldItem = Items[Index];
 
-    if (Success)
+    if (ActiveTransaction)
     {
-        // Log the item being added with its asset path for debugging
-        UE_LOG(LogTemp, Log, TEXT("Adding item to slot %d: Key=%s, AssetPath=%s"), 
-            LocalEmptyIndex,
-            *LocalItemInfo.RegistryKey.ToString(),
-            *LocalItemInfo.ItemAsset.ToSoftObjectPath().ToString());
-            
-        Items[LocalEmptyIndex] = LocalItemInfo;
-        UpdateUI(LocalEmptyIndex, LocalItemInfo);
-        return true;
+        ActiveTransaction->RecordWrite(this, Index, OldItem);
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("No empty slot found for item: %s"), 
-        *LocalItemInfo.RegistryKey.ToString());
-    return false;
-}
+    Items.SetSlot(Index, Item);
+    MARK_PROPERTY_DIRTY_FROM_NAME(UItemContainerBase, Items, this);
+    WriteSlotStore(Index, Item);
+    UpdateOccupancy(Index, Item);
+    UpdateStackIndex(Index, OldItem, Item);
+    MarkSlotDirty(Index);
 
-
-void UItemContainerBase::OnSlotDrop_Implementation(UItemContainerBase* FromContainer, int32 FromItemIndex,
-                                                   int32 DroppedItemIndex)
-{
-    UE_LOG(LogTemp, Log, TEXT("UItemContainerBase::OnSlotDrop: FromContainer=%p, FromItemIndex=%d, DroppedItemIndex=%d"),
-        FromContainer, FromItemIndex, DroppedItemIndex);
-        
-    // Add validation just in case
-    if (!FromContainer)
+    // Listeners only see the final contents of a batch, never its intermediate states
+    if (IsBatchingSlotUpdates())
     {
-        UE_LOG(LogTemp, Warning, TEXT("OnSlotDrop: FromContainer is null"));
+        PendingBatchSlots.AddUnique(Index);
         return;
     }
 
-    HandleSlotDrop(FromContainer, FromItemIndex, DroppedItemIndex);
+    OnSlotChanged.Broadcast(Index, Item);
 }
 
+void UItemContainerBase::WriteSlotStore(const int32 Index, const FItemStructure& Item)
+{
+    const int32 OldDefinitionId = SlotStore.GetDefinitionId(Index);
+    const int32 OldQuantity = SlotStore.GetQuantity(Index);
+    const FName OldKey = SlotStore.GetRegistryKey(Index);
+
+    SlotStore.Set(Index, Item);
 
+    UpdateTotals(OldDefinitionId, OldQuantity, SlotStore.GetDefinitionId(Index), SlotStore.GetQuantity(Index));
+    UpdateQueryIndex(Index, OldDefinitionId, OldKey, OldQuantity);
+}
 
-void UItemContainerBase::HandleSlotDrop(UItemContainerBase* HandleFromContainer, int32 HandleFromItemIndex,
-    int32 HandleDroppedItemIndex)
+//===========================================Occupancy====================================================
+bool UItemContainerBase::IsOccupyingItem(const FItemStructure& Item)
 {
-    
+    return !Item.RegistryKey.IsNone() && !Item.ItemAsset.IsNull() && Item.ItemQuantity > 0;
 }
 
-
-// ================================================ TransferItem ================================================
-void UItemContainerBase::TransferItem(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToTransfer)
+void UItemContainerBase::UpdateOccupancy(const int32 Index, const FItemStructure& Item)
 {
-    UE_LOG(LogTemp, Log, TEXT("TransferItem: ToComponent=%p, ToSpecificIndex=%d, ItemIndexToTransfer=%d"),
-        ToComponent, ToSpecificIndex, ItemIndexToTransfer);
-        
-    // Early out check - invalid parameters
-    if (!ToComponent || !ToComponent->IsValidLowLevel())
+    // Clients build the bitset lazily as slots arrive
+    if (OccupiedSlots.Num() < Items.Num())
     {
-        UE_LOG(LogTemp, Warning, TEXT("TransferItem: Invalid receiver component"));
-        return;
+        OccupiedSlots.Add(false, Items.Num() - OccupiedSlots.Num());
     }
-    
-    // Check if attempting to move to same slot in same container
-    if (ToComponent == this && ToSpecificIndex == ItemIndexToTransfer)
+
+    if (OccupiedSlots.IsValidIndex(Index))
     {
-        UE_LOG(LogTemp, Log, TEXT("TransferItem: Attempting to move to same slot in same container - ignoring"));
-        return;
+        OccupiedSlots[Index] = IsOccupyingItem(Item);
     }
-    
-    // Get the item to move
-    FItemStructure ItemToMove = GetItemAtIndex(ItemIndexToTransfer);
-    
-    // Validate item exists
-    if (ItemToMove.RegistryKey.IsNone())
+}
+
+//===========================================Stack Index====================================================
+bool UItemContainerBase::IsPartialStack(const FItemStructure& Item)
+{
+    return IsOccupyingItem(Item) && Item.StackSize > 1 && Item.ItemQuantity < Item.StackSize;
+}
+
+void UItemContainerBase::UpdateStackIndex(const int32 Index, const FItemStructure& OldItem, const FItemStructure& NewItem)
+{
+    const bool bWasPartial = IsPartialStack(OldItem);
+    const bool bIsPartial = IsPartialStack(NewItem);
+
+    // Nothing to do if the slot stays a partial stack of the same item
+    if (bWasPartial && bIsPartial && OldItem.RegistryKey == NewItem.RegistryKey)
     {
-        UE_LOG(LogTemp, Warning, TEXT("TransferItem: Trying to move an empty item"));
         return;
     }
-    
-    UE_LOG(LogTemp, Log, TEXT("Item details - Registry Key: %s, Quantity: %d, Asset Path: %s"),
-        *ItemToMove.RegistryKey.ToString(),
-        ItemToMove.ItemQuantity,
-        ItemToMove.ItemAsset.IsNull() ? TEXT("NULL") : *ItemToMove.ItemAsset.ToSoftObjectPath().ToString());
-    
-    // Check if destination slot is empty
-    if (ToComponent->IsSlotEmpty(ToSpecificIndex))
+
+    if (bWasPartial)
     {
-        // Add item to destination container
-        bool bAddSuccess = false;
-        ToComponent->AddItemToIndex(ItemToMove, ToSpecificIndex, ItemIndexToTransfer, bAddSuccess);
-        
-        if (bAddSuccess)
+        if (TArray<int32>* Slots = PartialStackSlots.Find(OldItem.RegistryKey))
         {
-            // Remove item from source container
-            bool bRemovalSuccess = false;
-            RemoveItemAtIndex(ItemIndexToTransfer, bRemovalSuccess);
-            
-            if (!bRemovalSuccess)
+            Slots->Remove(Index);
+            if (Slots->IsEmpty())
             {
-                UE_LOG(LogTemp, Warning, TEXT("TransferItem: Failed to remove item at original slot %d"), ItemIndexToTransfer);
-                
-                // Clear the slot manually if removal failed through normal channels
-                FItemStructure EmptyItem;
-                Items[ItemIndexToTransfer] = EmptyItem;
-                
-                // Use ResetItem on owner instead of UpdateUI if possible
-                if (GetOwner() && GetOwner()->Implements<UPlayerInterface>())
-                {
-                    IPlayerInterface::Execute_ResetItem(GetOwner(), ContainerType, ItemIndexToTransfer);
-                }
-                else
-                {
-                    // Fallback to UpdateUI
-                    UpdateUI(ItemIndexToTransfer, EmptyItem);
-                }
+                PartialStackSlots.Remove(OldItem.RegistryKey);
             }
-            
-            UE_LOG(LogTemp, Log, TEXT("TransferItem: Successfully moved item from slot %d to slot %d"),
-                ItemIndexToTransfer, ToSpecificIndex);
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("TransferItem: Failed to add item to destination slot"));
         }
     }
-    else
+
+    if (bIsPartial)
     {
-        // Implement item swapping logic
-        FItemStructure DestinationItem = ToComponent->GetItemAtIndex(ToSpecificIndex);
-        
-        // Check if we should stack the items (same items with stackable property)
-        if (ItemToMove.RegistryKey == DestinationItem.RegistryKey)
-        {
-            // Load the item info to check if it's stackable
-            UItemInfo* ItemInfo = nullptr;
-            if (!DestinationItem.ItemAsset.IsNull())
-            {
-                ItemInfo = Cast<UItemInfo>(DestinationItem.ItemAsset.LoadSynchronous());
-            }
-            
-            if (ItemInfo && ItemInfo->bStackable)
-            {
-                UE_LOG(LogTemp, Log, TEXT("TransferItem: Items can be stacked, checking stack limits"));
-                
-                int32 MaxStack = ItemInfo->StackSize;
-                int32 DestinationQuantity = DestinationItem.ItemQuantity;
-                int32 SourceQuantity = ItemToMove.ItemQuantity;
-                
-                // Check if destination stack has room
-                if (DestinationQuantity < MaxStack)
-                {
-                    int32 SpaceInStack = MaxStack - DestinationQuantity;
-                    int32 AmountToTransfer = FMath::Min(SourceQuantity, SpaceInStack);
-                    
-                    UE_LOG(LogTemp, Log, TEXT("TransferItem: Stacking %d items onto existing stack of %d (max: %d)"),
-                        AmountToTransfer, DestinationQuantity, MaxStack);
-                    
-                    // Update destination stack
-                    DestinationItem.ItemQuantity += AmountToTransfer;
-                    ToComponent->Items[ToSpecificIndex] = DestinationItem;
-                    ToComponent->UpdateUI(ToSpecificIndex, DestinationItem);
-                    
-                    // Update source stack or remove source item if completely transferred
-                    if (AmountToTransfer >= SourceQuantity)
-                    {
-                        // Clear source slot
-                        bool bRemovalSuccess = false;
-                        RemoveItemAtIndex(ItemIndexToTransfer, bRemovalSuccess);
-                        
-                        UE_LOG(LogTemp, Log, TEXT("TransferItem: Completely transferred source stack to destination"));
-                    }
-                    else
-                    {
-                        // Reduce source stack
-                        ItemToMove.ItemQuantity -= AmountToTransfer;
-                        Items[ItemIndexToTransfer] = ItemToMove;
-                        UpdateUI(ItemIndexToTransfer, ItemToMove);
-                        
-                        UE_LOG(LogTemp, Log, TEXT("TransferItem: Partially transferred source stack (%d remaining)"),
-                            ItemToMove.ItemQuantity);
-                    }
-                    
-                    return;
-                }
-            }
-        }
-        
-        // If we get here, we're performing a swap instead of stacking
-        UE_LOG(LogTemp, Log, TEXT("TransferItem: Swapping items between slots - Source: %s, Destination: %s"),
-            *ItemToMove.RegistryKey.ToString(), *DestinationItem.RegistryKey.ToString());
-        
-        // Save copies of both items
-        FItemStructure SourceItemCopy = ItemToMove;
-        FItemStructure DestinationItemCopy = DestinationItem;
-        
-        // Step 1: Update the destination slot with the source item
-        ToComponent->Items[ToSpecificIndex] = SourceItemCopy;
-        ToComponent->UpdateUI(ToSpecificIndex, SourceItemCopy);
-        
-        // Step 2: Update the source slot with the destination item
-        Items[ItemIndexToTransfer] = DestinationItemCopy;
-        UpdateUI(ItemIndexToTransfer, DestinationItemCopy);
-        
-        UE_LOG(LogTemp, Log, TEXT("TransferItem: Successfully swapped items between slots %d and %d"),
-            ItemIndexToTransfer, ToSpecificIndex);
+        // Keep slots ordered so stacks fill front to back
+        TArray<int32>& Slots = PartialStackSlots.FindOrAdd(NewItem.RegistryKey);
+        Slots.Insert(Index, Algo::LowerBound(Slots, Index));
     }
 }
 
-
-// ================================================ IsSlotEmpty ================================================
-bool UItemContainerBase::IsSlotEmpty(int32 SlotIndex) const
+//===========================================HandleSlotReplicated====================================================
+void UItemContainerBase::HandleSlotReplicated(const int32 SlotIndex)
 {
-    if (!Items.IsValidIndex(SlotIndex))
+    if (Items.IsValidIndex(SlotIndex))
     {
-        return true;
+        // Clients size the store as slots arrive
+        SlotStore.Reserve(Items.Num());
+        WriteSlotStore(SlotIndex, Items[SlotIndex]);
+        UpdateOccupancy(SlotIndex, Items[SlotIndex]);
+        OnSlotChanged.Broadcast(SlotIndex, Items[SlotIndex]);
     }
+}
 
-    const FItemStructure& Item = Items[SlotIndex];
-    return Item.RegistryKey == NAME_None || Item.ItemAsset.IsNull() || Item.ItemQuantity <= 0;
+//===========================================Server_AddItem====================================================
+void UItemContainerBase::Server_AddItem_Implementation(const FItemStructure& Item)
+{
+    AddItem(Item);
 }
 
+//===========================================UpdateUI====================================================
+void UItemContainerBase::UpdateUI(const int32 Index, const FItemStructure& ItemInfo)
+{
+    // The slot's current contents are sent with the next flush, ItemInfo is no longer needed
+    MarkSlotDirty(Index);
+}
 
-// ================================================ GetItemAtIndex ================================================
-FItemStructure UItemContainerBase::GetItemAtIndex(int32 Index) const
+//===========================================Dirty Slots====================================================
+void UItemContainerBase::MarkSlotDirty(const int32 Index)
 {
-    int32 LocalIndex = Index;
+    if (Index < 0)
+    {
+        return;
+    }
 
-    if (Items.IsValidIndex(LocalIndex))
+    if (DirtySlots.Num() <= Index)
     {
-        UE_LOG(LogTemp, Log, TEXT("GetItemAtIndex: Index %d contains item with key %s"),
-            LocalIndex,
-            Items[LocalIndex].RegistryKey.IsNone() ? TEXT("None") : *Items[LocalIndex].RegistryKey.ToString());
-        
-        return Items[LocalIndex];
+        DirtySlots.Add(false, Index + 1 - DirtySlots.Num());
     }
-    else
+
+    DirtySlots[Index] = true;
+
+    // Batches flush when they close; everything else waits for this frame's tick
+    if (!IsBatchingSlotUpdates() && !IsComponentTickEnabled())
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetItemAtIndex: Invalid index %d (array size: %d)"),
-            LocalIndex, Items.Num());
-        return FItemStructure();
+        SetComponentTickEnabled(true);
     }
 }
 
+void UItemContainerBase::FlushDirtySlots()
+{
+    // An open batch or transaction flushes itself when it closes
+    if (IsBatchingSlotUpdates())
+    {
+        return;
+    }
+
+    SetComponentTickEnabled(false);
+    BroadcastTotalsIfChanged();
 
-// ================================================ AddItemToIndex ================================================
-void UItemContainerBase::AddItemToIndex(const FItemStructure& ItemInfo, int32 LocalSpecificIndex, int32 LocalItemIndex, bool& Success)
+    TArray<int32> ChangedSlots;
+    for (TConstSetBitIterator<> It(DirtySlots); It; ++It)
+    {
+        ChangedSlots.Add(It.GetIndex());
+    }
+
+    if (ChangedSlots.IsEmpty())
+    {
+        return;
+    }
+
+    DirtySlots.Init(false, DirtySlots.Num());
+    NotifySlotsChanged(ChangedSlots);
+}
+
+//===========================================Totals====================================================
+void UItemContainerBase::UpdateTotals(const int32 OldDefinitionId, const int32 OldQuantity, const int32 NewDefinitionId, const int32 NewQuantity)
 {
-    const FItemStructure& LocalItem = ItemInfo;
-    int32 LocalIndex = LocalSpecificIndex;
-    int32 LocalFromIndex = LocalItemIndex;
+    if (OldDefinitionId == NewDefinitionId && OldQuantity == NewQuantity)
+    {
+        return;
+    }
 
-    UE_LOG(LogTemp, Log, TEXT("AddItemToIndex: ItemKey=%s, LocalIndex=%d, LocalFromIndex=%d"),
-        *ItemInfo.RegistryKey.ToString(), LocalIndex, LocalFromIndex);
+    // Slot ids are only assigned when the index exists, so without it there is nothing to count
+    const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+    if (!AssetManager)
+    {
+        return;
+    }
 
-    Success = false;
-    
-    if (IsSlotEmpty(LocalIndex))
+    auto ApplyDelta = [this, AssetManager](const int32 DefinitionId, const int32 QuantityDelta)
     {
-        if (Items.IsValidIndex(LocalIndex))
+        const FItemIndexEntry* Definition = AssetManager->GetItemIndexEntry(DefinitionId);
+        if (!Definition || QuantityDelta == 0)
         {
-            Items[LocalIndex] = LocalItem;
-            
-            // Update UI for the new slot
-            UpdateUI(LocalIndex, LocalItem);
-            
-            Success = true;
-            UE_LOG(LogTemp, Log, TEXT("AddItemToIndex: Successfully added item to slot %d"), LocalIndex);
+            return;
         }
-        else
+
+        TotalWeightMilli += FMath::RoundToInt64(static_cast<double>(Definition->ItemWeight) * 1000.0) * QuantityDelta;
+
+        const int32 CategoryIndex = static_cast<int32>(Definition->ItemCategory);
+        if (CategoryCounts.Num() <= CategoryIndex)
         {
-            UE_LOG(LogTemp, Warning, TEXT("AddItemToIndex: Invalid slot index %d"), LocalIndex);
+            CategoryCounts.SetNumZeroed(CategoryIndex + 1);
         }
-    }
-    else
+        CategoryCounts[CategoryIndex] += QuantityDelta;
+    };
+
+    ApplyDelta(OldDefinitionId, -OldQuantity);
+    ApplyDelta(NewDefinitionId, NewQuantity);
+
+    WeightClass = ComputeWeightClass(TotalWeightMilli);
+
+    // Clients have no dirty slots of their own, so the tick is what gets the delegates out
+    if (TotalWeightMilli != BroadcastWeightMilli && !IsBatchingSlotUpdates() && !IsComponentTickEnabled())
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddItemToIndex: Slot %d is not empty!"), LocalIndex);
+        SetComponentTickEnabled(true);
     }
 }
 
-// ================================================ RemoveItemAtIndex ================================================
-void UItemContainerBase::RemoveItemAtIndex(int32 RemovedIndex, bool& Success)
+E_WeightClass UItemContainerBase::ComputeWeightClass(const int64 WeightMilli) const
 {
-    if (Items.IsValidIndex(RemovedIndex))
+    if (WeightMilli <= 0)
     {
-        // Create empty item and assign it to the slot
-        FItemStructure EmptyItem;
-        Items[RemovedIndex] = EmptyItem;
-        
-        // Update UI to show empty slot
-        UpdateUI(RemovedIndex, EmptyItem);
+        return E_WeightClass::None;
+    }
+
+    if (MaxWeight <= 0.0f)
+    {
+        return E_WeightClass::Light;
+    }
+
+    const double LoadFraction = static_cast<double>(WeightMilli) / (static_cast<double>(MaxWeight) * 1000.0);
+    if (LoadFraction >= HeavyLoadFraction)
+    {
+        return E_WeightClass::Heavy;
+    }
+
+    return LoadFraction >= MediumLoadFraction ? E_WeightClass::Medium : E_WeightClass::Light;
+}
+
+void UItemContainerBase::BroadcastTotalsIfChanged()
+{
+    if (TotalWeightMilli == BroadcastWeightMilli)
+    {
+        return;
+    }
+
+    const E_WeightClass PreviousWeightClass = ComputeWeightClass(BroadcastWeightMilli);
+    BroadcastWeightMilli = TotalWeightMilli;
+
+    OnWeightChanged.Broadcast(GetTotalWeight(), MaxWeight);
+
+    if (WeightClass != PreviousWeightClass)
+    {
+        OnWeightClassChanged.Broadcast(WeightClass);
+    }
+}
+
+int32 UItemContainerBase::GetCategoryCount(const E_ItemCategory Category) const
+{
+    PrepareSlotAccess();
+
+    const int32 CategoryIndex = static_cast<int32>(Category);
+    return CategoryCounts.IsValidIndex(CategoryIndex) ? CategoryCounts[CategoryIndex] : 0;
+}
+
+//===========================================Query Index====================================================
+namespace ContainerQuery
+{
+    static void SetSlotBit(TArray<TBitArray<>>& SlotSets, const int32 SetIndex, const int32 SlotIndex, const bool bValue)
+    {
+        if (SlotSets.Num() <= SetIndex)
+        {
+            if (!bValue)
+            {
+                return;
+            }
+            SlotSets.SetNum(SetIndex + 1);
+        }
+
+        TBitArray<>& Slots = SlotSets[SetIndex];
+        if (Slots.Num() <= SlotIndex)
+        {
+            if (!bValue)
+            {
+                return;
+            }
+            Slots.Add(false, SlotIndex + 1 - Slots.Num());
+        }
+
+        Slots[SlotIndex] = bValue;
+    }
+
+    static const TBitArray<>* FindSlotSet(const TArray<TBitArray<>>& SlotSets, const int32 SetIndex)
+    {
+        return SlotSets.IsValidIndex(SetIndex) ? &SlotSets[SetIndex] : nullptr;
+    }
+
+    static int32 FirstSetBit(const TBitArray<>* Slots)
+    {
+        return Slots ? Slots->Find(true) : INDEX_NONE;
+    }
+
+    static void ForEachSetBit(const TBitArray<>* Slots, const TFunctionRef<void(int32)> Visitor)
+    {
+        if (!Slots)
+        {
+            return;
+        }
+
+        for (TConstSetBitIterator<> It(*Slots); It; ++It)
+        {
+            Visitor(It.GetIndex());
+        }
+    }
+}
+
+void UItemContainerBase::UpdateQueryIndex(const int32 Index, const int32 OldDefinitionId, const FName OldKey, const int32 OldQuantity)
+{
+    const int32 NewDefinitionId = SlotStore.GetDefinitionId(Index);
+    const int32 NewQuantity = SlotStore.GetQuantity(Index);
+    const FName NewKey = SlotStore.GetRegistryKey(Index);
+
+    // Per-key totals cover items outside the index too
+    if (OldKey != NewKey || OldQuantity != NewQuantity)
+    {
+        if (!OldKey.IsNone() && OldQuantity > 0)
+        {
+            int32& Count = ItemCounts.FindOrAdd(OldKey);
+            Count -= OldQuantity;
+            if (Count <= 0)
+            {
+                ItemCounts.Remove(OldKey);
+            }
+        }
+
+        if (!NewKey.IsNone() && NewQuantity > 0)
+        {
+            ItemCounts.FindOrAdd(NewKey) += NewQuantity;
+        }
+    }
+
+    const bool bWasStored = OldDefinitionId != INDEX_NONE && OldQuantity > 0;
+    const bool bIsStored = NewDefinitionId != INDEX_NONE && NewQuantity > 0;
+    if (bWasStored == bIsStored && OldDefinitionId == NewDefinitionId)
+    {
+        return;
+    }
+
+    const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+    if (!AssetManager)
+    {
+        return;
+    }
+
+    if (const FItemIndexEntry* OldDefinition = bWasStored ? AssetManager->GetItemIndexEntry(OldDefinitionId) : nullptr)
+    {
+        ContainerQuery::SetSlotBit(CategorySlots, static_cast<int32>(OldDefinition->ItemCategory), Index, false);
+        ContainerQuery::SetSlotBit(TypeSlots, static_cast<int32>(OldDefinition->ItemType), Index, false);
+    }
+
+    if (const FItemIndexEntry* NewDefinition = bIsStored ? AssetManager->GetItemIndexEntry(NewDefinitionId) : nullptr)
+    {
+        ContainerQuery::SetSlotBit(CategorySlots, static_cast<int32>(NewDefinition->ItemCategory), Index, true);
+        ContainerQuery::SetSlotBit(TypeSlots, static_cast<int32>(NewDefinition->ItemType), Index, true);
+    }
+}
+
+bool UItemContainerBase::HasAnyItem(const FName RegistryKey) const
+{
+    PrepareSlotAccess();
+
+    return ItemCounts.Contains(RegistryKey);
+}
+
+bool UItemContainerBase::HasAnyOfCategory(const E_ItemCategory Category) const
+{
+    PrepareSlotAccess();
+
+    return FirstSlotOfCategory(Category) != INDEX_NONE;
+}
+
+bool UItemContainerBase::HasAnyOfType(const E_ItemType Type) const
+{
+    PrepareSlotAccess();
+
+    return FirstSlotOfType(Type) != INDEX_NONE;
+}
+
+int32 UItemContainerBase::FirstSlotOfItem(const FName RegistryKey) const
+{
+    PrepareSlotAccess();
+
+    int32 FirstSlot = INDEX_NONE;
+    if (HasAnyItem(RegistryKey))
+    {
+        ScanSlotsOfItem(RegistryKey, [&FirstSlot](const int32 SlotIndex)
+        {
+            FirstSlot = SlotIndex;
+            return false;
+        });
+    }
+    return FirstSlot;
+}
+
+int32 UItemContainerBase::FirstSlotOfCategory(const E_ItemCategory Category) const
+{
+    PrepareSlotAccess();
+
+    return ContainerQuery::FirstSetBit(ContainerQuery::FindSlotSet(CategorySlots, static_cast<int32>(Category)));
+}
+
+int32 UItemContainerBase::FirstSlotOfType(const E_ItemType Type) const
+{
+    PrepareSlotAccess();
+
+    return ContainerQuery::FirstSetBit(ContainerQuery::FindSlotSet(TypeSlots, static_cast<int32>(Type)));
+}
+
+void UItemContainerBase::ForEachSlotOfItem(const FName RegistryKey, const TFunctionRef<void(int32 SlotIndex)> Visitor) const
+{
+    PrepareSlotAccess();
+
+    if (HasAnyItem(RegistryKey))
+    {
+        ScanSlotsOfItem(RegistryKey, [&Visitor](const int32 SlotIndex)
+        {
+            Visitor(SlotIndex);
+            return true;
+        });
+    }
+}
+
+void UItemContainerBase::ScanSlotsOfItem(const FName RegistryKey, const TFunctionRef<bool(int32 SlotIndex)> Visitor) const
+{
+    const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+    const int32 DefinitionId = AssetManager ? AssetManager->GetItemNetIndex(RegistryKey) : INDEX_NONE;
+
+    // Indexed items: only walk slots of the item's type and match definition ids
+    if (const FItemIndexEntry* Definition = AssetManager ? AssetManager->GetItemIndexEntry(DefinitionId) : nullptr)
+    {
+        if (const TBitArray<>* Slots = ContainerQuery::FindSlotSet(TypeSlots, static_cast<int32>(Definition->ItemType)))
+        {
+            for (TConstSetBitIterator<> It(*Slots); It; ++It)
+            {
+                if (SlotStore.GetDefinitionId(It.GetIndex()) == DefinitionId && !Visitor(It.GetIndex()))
+                {
+                    return;
+                }
+            }
+        }
+        return;
+    }
+
+    // Items outside the index are only tracked by key
+    for (int32 SlotIndex = 0; SlotIndex < SlotStore.Num(); ++SlotIndex)
+    {
+        if (SlotStore.GetRegistryKey(SlotIndex) == RegistryKey && SlotStore.GetQuantity(SlotIndex) > 0 && !Visitor(SlotIndex))
+        {
+            return;
+        }
+    }
+}
+
+void UItemContainerBase::ForEachSlotOfCategory(const E_ItemCategory Category, const TFunctionRef<void(int32 SlotIndex)> Visitor) const
+{
+    PrepareSlotAccess();
+
+    ContainerQuery::ForEachSetBit(ContainerQuery::FindSlotSet(CategorySlots, static_cast<int32>(Category)), Visitor);
+}
+
+void UItemContainerBase::ForEachSlotOfType(const E_ItemType Type, const TFunctionRef<void(int32 SlotIndex)> Visitor) const
+{
+    PrepareSlotAccess();
+
+    ContainerQuery::ForEachSetBit(ContainerQuery::FindSlotSet(TypeSlots, static_cast<int32>(Type)), Visitor);
+}
+
+//===========================================Slot Batching====================================================
+void UItemContainerBase::BeginSlotBatch()
+{
+    ++SlotBatchDepth;
+}
+
+void UItemContainerBase::EndSlotBatch()
+{
+    if (!ensure(SlotBatchDepth > 0))
+    {
+        return;
+    }
+
+    if (--SlotBatchDepth > 0)
+    {
+        return;
+    }
+
+    // Swap out first so notifications can't append to the list we're sending
+    TArray<int32> ChangedSlots = MoveTemp(PendingBatchSlots);
+    PendingBatchSlots.Reset();
+
+    for (const int32 SlotIndex : ChangedSlots)
+    {
+        if (Items.IsValidIndex(SlotIndex))
+        {
+            OnSlotChanged.Broadcast(SlotIndex, Items[SlotIndex]);
+        }
+    }
+
+    // Batched and transactional changes reach the owner right away, in one notification
+    FlushDirtySlots();
+}
+
+void UItemContainerBase::CancelSlotBatch(const int32 PendingSlotMark)
+{
+    // Slots queued before the mark belong to an outer batch and still get their OnSlotChanged.
+    // Restored slots stay dirty, so the owner is resent their (unchanged) contents.
+    if (PendingBatchSlots.Num() > PendingSlotMark)
+    {
+        PendingBatchSlots.SetNum(FMath::Max(PendingSlotMark, 0));
+    }
+
+    EndSlotBatch();
+}
+
+void UItemContainerBase::NotifySlotsChanged(const TArray<int32>& SlotIndices)
+{
+    if (SlotIndices.IsEmpty())
+    {
+        return;
+    }
+
+    if (!SendsSlotUpdates())
+    {
+        return;
+    }
+
+    AActor* OwnerActor = GetOwner();
+    TArray<FItemSlotUpdate> SlotUpdates;
+    SlotUpdates.Reserve(SlotIndices.Num());
+    for (const int32 SlotIndex : SlotIndices)
+    {
+        if (Items.IsValidIndex(SlotIndex))
+        {
+            FItemSlotUpdate& SlotUpdate = SlotUpdates.AddDefaulted_GetRef();
+            SlotUpdate.SlotIndex = SlotIndex;
+            // The store, not Items: a linked hotbar keeps its contents only there
+            SlotUpdate.Item = SlotStore.MakeItem(SlotIndex);
+        }
+    }
+
+    IPlayerInterface::Execute_UpdateItems(OwnerActor, ContainerType, SlotUpdates);
+    UE_LOG(LogInventory, Verbose, TEXT("NotifySlotsChanged: Sent %d slot updates in one batch"), SlotUpdates.Num());
+}
+
+//===========================================FindEmptySlot====================================================
+bool UItemContainerBase::FindEmptySlot(bool& Success, int32& EmptyIndex) const
+{
+    PrepareSlotAccess();
+
+    // Initialize with invalid state
+    Success = false;
+    EmptyIndex = -1;
+
+    // First clear bit in the occupancy bitset
+    int32 FreeIndex = OccupiedSlots.Find(false);
+
+    // Slots past the end of a partially received bitset are still empty
+    if (FreeIndex == INDEX_NONE && OccupiedSlots.Num() < Items.Num())
+    {
+        FreeIndex = OccupiedSlots.Num();
+    }
+
+    if (FreeIndex != INDEX_NONE && FreeIndex < Items.Num())
+    {
+        Success = true;
+        EmptyIndex = FreeIndex;
+    }
+
+    return Success;
+
+}
+//===========================================AddItem====================================================
+// In ItemContainerBase.cpp
+bool UItemContainerBase::AddItem(const FItemStructure& Item)
+{
+    PrepareSlotAccess();
+
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        Server_AddItem(Item);
+        return true;
+    }
+    
+    // Create a working copy of the item data
+    FItemStructure LocalItemInfo = Item;
+    
+    // Ensure we have a valid asset reference and the real stack size before proceeding
+    if (!ResolveItemDefinition(LocalItemInfo))
+    {
+        UE_LOG(LogInventory, Error, TEXT("Cannot add item with invalid asset reference. RegKey: %s"), 
+            LocalItemInfo.RegistryKey.IsNone() ? TEXT("NONE") : *LocalItemInfo.RegistryKey.ToString());
+        return false;
+    }
+
+    // Fill existing partial stacks first, then spill into empty slots
+    const int32 Remaining = PlaceItem(LocalItemInfo);
+    if (Remaining == 0)
+    {
+        return true;
+    }
+
+    SURVIVAL_LOG_RATELIMITED(LogInventory, Warning, 1.0, TEXT("No room for %d of item: %s"), 
+        Remaining, *LocalItemInfo.RegistryKey.ToString());
+    return false;
+}
+
+//===========================================AddItems====================================================
+TArray<FItemAddResult> UItemContainerBase::AddItems(const TArray<FItemStructure>& InItems)
+{
+    PrepareSlotAccess();
+
+    TArray<FItemAddResult> Results;
+
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        // One RPC for the whole batch instead of one per item
+        Server_AddItems(InItems);
+        return Results;
+    }
+
+    Results.SetNum(InItems.Num());
+
+    BeginSlotBatch();
+
+    for (int32 ItemIndex = 0; ItemIndex < InItems.Num(); ++ItemIndex)
+    {
+        FItemStructure LocalItemInfo = InItems[ItemIndex];
+        FItemAddResult& Result = Results[ItemIndex];
+        const int32 Requested = FMath::Max(LocalItemInfo.ItemQuantity, 0);
+
+        // One index lookup per entry; the index already is the per-key cache
+        if (!ResolveItemDefinition(LocalItemInfo))
+        {
+            UE_LOG(LogInventory, Warning, TEXT("AddItems: Skipping entry %d with unresolved asset. RegKey: %s"),
+                ItemIndex, *LocalItemInfo.RegistryKey.ToString());
+            Result.QuantityRemaining = Requested;
+            continue;
+        }
+
+        Result.QuantityRemaining = PlaceItem(LocalItemInfo);
+        Result.QuantityAdded = Requested - Result.QuantityRemaining;
+        Result.bFullyAdded = Result.QuantityRemaining == 0;
+    }
+
+    EndSlotBatch();
+
+    return Results;
+}
+
+void UItemContainerBase::Server_AddItems_Implementation(const TArray<FItemStructure>& InItems)
+{
+    AddItems(InItems);
+}
+
+//===========================================RemoveItems====================================================
+TArray<bool> UItemContainerBase::RemoveItems(const TArray<int32>& SlotIndices)
+{
+    PrepareSlotAccess();
+
+    TArray<bool> Results;
+    Results.Reserve(SlotIndices.Num());
+
+    BeginSlotBatch();
+
+    for (const int32 SlotIndex : SlotIndices)
+    {
+        bool bRemoved = false;
+        RemoveItemAtIndex(SlotIndex, bRemoved);
+        Results.Add(bRemoved);
+    }
+
+    EndSlotBatch();
+
+    return Results;
+}
+
+//===========================================SortContainer====================================================
+namespace ContainerSort
+{
+    /** Occupied slot waiting to be placed back, with its precomputed key */
+    struct FSortEntry
+    {
+        uint64 Key = 0;
+        int32 SourceSlot = INDEX_NONE;
+        FItemStructure Item;
+    };
+
+    /** Unindexed items have no definition data and go after everything else */
+    constexpr uint32 UnknownDefinitionBits = 0xFFFFFFFEu;
+
+    static uint32 RarityDescending(const E_ItemRarity Rarity)
+    {
+        return 0xFFu - static_cast<uint8>(Rarity);
+    }
+
+    /** Definition-dependent upper 32 bits of the key, laid out per sort method */
+    static uint32 MakeDefinitionBits(const FItemIndexEntry& Definition, const E_SortMethod Method)
+    {
+        const uint32 Category = static_cast<uint8>(Definition.ItemCategory);
+        const uint32 Type = static_cast<uint8>(Definition.ItemType);
+        const uint32 Name = static_cast<uint32>(FMath::Clamp(Definition.NameOrdinal, 0, 0xFFFF));
+
+        switch (Method)
+        {
+        case E_SortMethod::Name:
+            return Name << 16 | Category << 8 | RarityDescending(Definition.ItemRarity);
+
+        case E_SortMethod::Type:
+            return Category << 24 | Type << 16 | Name;
+
+        case E_SortMethod::Rarity:
+            return RarityDescending(Definition.ItemRarity) << 24 | Category << 16 | Name;
+
+        case E_SortMethod::Weight:
+        {
+            // Heaviest first, in hundredths of a unit
+            const uint32 Weight = static_cast<uint32>(FMath::Clamp(FMath::RoundToInt(Definition.ItemWeight * 100.0f), 0, 0xFFFFFF));
+            return (0xFFFFFFu - Weight) << 8 | Category;
+        }
+
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * Packed key: [definition bits:32][definition id:16][inverted quantity:16].
+     * Identical items end up adjacent and fuller stacks come first.
+     */
+    static uint64 MakeSortKey(const USurvivalAssetManager* AssetManager, const int32 DefinitionId, const int32 Quantity, const E_SortMethod Method)
+    {
+        const FItemIndexEntry* Definition = AssetManager ? AssetManager->GetItemIndexEntry(DefinitionId) : nullptr;
+        const uint32 DefinitionBits = Definition ? MakeDefinitionBits(*Definition, Method) : UnknownDefinitionBits;
+        const uint32 IdBits = Definition ? static_cast<uint32>(DefinitionId & 0xFFFF) : 0xFFFFu;
+        const uint32 QuantityBits = 0xFFFFu - static_cast<uint32>(FMath::Clamp(Quantity, 0, 0xFFFF));
+
+        return static_cast<uint64>(DefinitionBits) << 32 | static_cast<uint64>(IdBits) << 16 | QuantityBits;
+    }
+
+    static bool IsSameContents(const FItemStructure& A, const FItemStructure& B)
+    {
+        return A.RegistryKey == B.RegistryKey
+            && A.ItemQuantity == B.ItemQuantity
+            && A.StackSize == B.StackSize
+            && A.CurrentHP == B.CurrentHP
+            && A.MaxHP == B.MaxHP
+            && A.CurrentAmmo == B.CurrentAmmo
+            && A.MaxAmmo == B.MaxAmmo
+            && A.ItemAsset == B.ItemAsset;
+    }
+}
+
+void UItemContainerBase::SortContainer(const E_SortMethod SortMethod)
+{
+    if (SortMethod == E_SortMethod::Value)
+    {
+        UE_LOG(LogInventory, Warning, TEXT("SortContainer: %s sorting by value is unsupported, items have no value"), *GetName());
+        return;
+    }
+
+    PrepareSlotAccess();
+
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        Server_SortContainer(SortMethod);
+        return;
+    }
+
+    using namespace ContainerSort;
+
+    const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+
+    // Gather occupied slots from the store
+    TArray<FSortEntry, TInlineAllocator<64>> Entries;
+    for (TConstSetBitIterator<> It(OccupiedSlots); It; ++It)
+    {
+        FSortEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.SourceSlot = It.GetIndex();
+        Entry.Item = SlotStore.MakeItem(Entry.SourceSlot);
+    }
+
+    // Merge partial stacks front to back; emptied entries drop out
+    TMap<FName, int32, TInlineSetAllocator<32>> OpenStackByKey;
+    TMap<int32, int32> MergedIntoSlot;
+    for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+    {
+        FItemStructure& Item = Entries[EntryIndex].Item;
+        if (Item.StackSize <= 1)
+        {
+            continue;
+        }
+
+        if (const int32* OpenIndex = OpenStackByKey.Find(Item.RegistryKey))
+        {
+            FItemStructure& OpenStack = Entries[*OpenIndex].Item;
+            const int32 AmountToMove = FMath::Min(Item.ItemQuantity, OpenStack.StackSize - OpenStack.ItemQuantity);
+            OpenStack.ItemQuantity += AmountToMove;
+            Item.ItemQuantity -= AmountToMove;
+
+            if (Item.ItemQuantity <= 0)
+            {
+                MergedIntoSlot.Add(Entries[EntryIndex].SourceSlot, Entries[*OpenIndex].SourceSlot);
+            }
+
+            if (OpenStack.ItemQuantity >= OpenStack.StackSize)
+            {
+                OpenStackByKey.Remove(Item.RegistryKey);
+            }
+        }
+
+        if (Item.ItemQuantity > 0 && Item.ItemQuantity < Item.StackSize && !OpenStackByKey.Contains(Item.RegistryKey))
+        {
+            OpenStackByKey.Add(Item.RegistryKey, EntryIndex);
+        }
+    }
+
+    Entries.RemoveAll([](const FSortEntry& Entry)
+    {
+        return Entry.Item.ItemQuantity <= 0;
+    });
+
+    if (SortMethod != E_SortMethod::None)
+    {
+        for (FSortEntry& Entry : Entries)
+        {
+            Entry.Key = MakeSortKey(AssetManager, SlotStore.GetDefinitionId(Entry.SourceSlot), Entry.Item.ItemQuantity, SortMethod);
+        }
+
+        // Source slot breaks ties so the result is deterministic
+        Algo::Sort(Entries, [](const FSortEntry& A, const FSortEntry& B)
+        {
+            return A.Key != B.Key ? A.Key < B.Key : A.SourceSlot < B.SourceSlot;
+        });
+    }
+
+    // Apply the permutation in place, writing only slots whose contents change
+    const FItemStructure EmptyItem;
+    int32 SlotsWritten = 0;
+
+    BeginSlotBatch();
+
+    for (int32 SlotIndex = 0; SlotIndex < Items.Num(); ++SlotIndex)
+    {
+        const FItemStructure& Target = Entries.IsValidIndex(SlotIndex) ? Entries[SlotIndex].Item : EmptyItem;
+
+        if (!Entries.IsValidIndex(SlotIndex) && IsSlotEmpty(SlotIndex))
+        {
+            continue;
+        }
+
+        if (!IsSameContents(SlotStore.MakeItem(SlotIndex), Target))
+        {
+            SetSlotItem(SlotIndex, Target);
+            ++SlotsWritten;
+        }
+    }
+
+    // Entry order is the new slot order; stacks merged away follow the stack they went into.
+    // Sent before the batch's slot notifications, so an emptied slot's references have already moved on.
+    TMap<int32, int32> MovedSlots;
+    for (int32 SlotIndex = 0; SlotIndex < Entries.Num(); ++SlotIndex)
+    {
+        if (Entries[SlotIndex].SourceSlot != SlotIndex)
+        {
+            MovedSlots.Add(Entries[SlotIndex].SourceSlot, SlotIndex);
+        }
+    }
+    for (const TPair<int32, int32>& Merged : MergedIntoSlot)
+    {
+        const int32* MergedTarget = MovedSlots.Find(Merged.Value);
+        MovedSlots.Add(Merged.Key, MergedTarget ? *MergedTarget : Merged.Value);
+    }
+    if (!MovedSlots.IsEmpty())
+    {
+        OnSlotsMoved.Broadcast(MovedSlots);
+    }
+
+    EndSlotBatch();
+
+    UE_LOG(LogInventory, Verbose, TEXT("SortContainer: %d items sorted, %d slots rewritten"), Entries.Num(), SlotsWritten);
+}
+
+void UItemContainerBase::Server_SortContainer_Implementation(const E_SortMethod SortMethod)
+{
+    SortContainer(SortMethod);
+}
+
+//===========================================Snapshots====================================================
+void UItemContainerBase::SaveSnapshot(TArray<uint8>& OutBytes) const
+{
+    PrepareSlotAccess();
+
+    FItemContainerSnapshot::Write(*this, OutBytes);
+}
+
+bool UItemContainerBase::LoadSnapshot(const TConstArrayView<uint8> Bytes)
+{
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        UE_LOG(LogInventory, Warning, TEXT("LoadSnapshot: Only the server can restore %s"), *GetName());
+        return false;
+    }
+
+    FItemContainerSnapshotReader Reader(Bytes);
+    if (Reader.HasError())
+    {
+        return false;
+    }
+
+    // Restore inside a transaction so a bad record leaves the old contents in place
+    FItemContainerTransaction Transaction;
+    if (!Transaction.Enlist(this))
+    {
+        return false;
+    }
+
+    const FItemStructure EmptyItem;
+    for (int32 SlotIndex = 0; SlotIndex < Items.Num(); ++SlotIndex)
+    {
+        if (!Items[SlotIndex].IsEmpty())
+        {
+            SetSlotItem(SlotIndex, EmptyItem);
+        }
+    }
+
+    int32 SlotIndex = INDEX_NONE;
+    FItemStructure Item;
+    while (Reader.Next(SlotIndex, Item))
+    {
+        if (!Items.IsValidIndex(SlotIndex))
+        {
+            UE_LOG(LogInventory, Warning, TEXT("LoadSnapshot: Slot %d does not fit in %s (%d slots)"), SlotIndex, *GetName(), Items.Num());
+            Transaction.Rollback();
+            return false;
+        }
+
+        SetSlotItem(SlotIndex, Item);
+    }
+
+    if (Reader.HasError())
+    {
+        Transaction.Rollback();
+        return false;
+    }
+
+    Transaction.Commit();
+
+    UE_LOG(LogInventory, Verbose, TEXT("LoadSnapshot: Restored %d slots into %s (schema v%d)"),
+        Reader.GetRecordCount(), *GetName(), Reader.GetSchemaVersion());
+    return true;
+}
+
+//===========================================ResolveItemDefinition====================================================
+bool UItemContainerBase::ResolveItemDefinition(FItemStructure& InOutItem) const
+{
+    const USurvivalAssetManager* AssetManager = !InOutItem.RegistryKey.IsNone() ? USurvivalAssetManager::GetIfValid() : nullptr;
+    const FItemIndexEntry* Definition = AssetManager ? AssetManager->GetItemIndexEntry(AssetManager->GetItemNetIndex(InOutItem.RegistryKey)) : nullptr;
+    if (Definition)
+    {
+        InOutItem.ItemAsset = TSoftObjectPtr<UItemInfo>(Definition->AssetPath);
+        InOutItem.StackSize = FMath::Max(Definition->StackSize, 1);
+        return true;
+    }
+
+    // Items outside the index (tests, content the scan didn't cover) only stack as far as they say
+    if (!InOutItem.ItemAsset.IsNull())
+    {
+        return true;
+    }
+
+    if (!InOutItem.RegistryKey.IsNone())
+    {
+        SURVIVAL_LOG_RATELIMITED(LogItemAssets, Warning, 1.0, TEXT("Failed to resolve asset for key: %s"), *InOutItem.RegistryKey.ToString());
+    }
+    return false;
+}
+
+//===========================================PlaceItem====================================================
+int32 UItemContainerBase::PlaceItem(const FItemStructure& Item)
+{
+    int32 Remaining = FMath::Max(Item.ItemQuantity, 0);
+
+    // Top up slots already holding a partial stack of the same item
+    if (const TArray<int32>* PartialSlots = PartialStackSlots.Find(Item.RegistryKey))
+    {
+        // Copy - filling a stack removes it from the index while we iterate
+        const TArray<int32> Candidates = *PartialSlots;
+        for (const int32 SlotIndex : Candidates)
+        {
+            if (Remaining <= 0)
+            {
+                break;
+            }
+
+            // Hot arrays only; the full item is built once we know we're writing
+            const int32 SpaceInStack = SlotStore.GetStackSize(SlotIndex) - SlotStore.GetQuantity(SlotIndex);
+            const int32 AmountToStack = FMath::Min(Remaining, SpaceInStack);
+            if (AmountToStack <= 0)
+            {
+                continue;
+            }
+
+            FItemStructure StackItem = SlotStore.MakeItem(SlotIndex);
+
+            UE_LOG(LogInventory, Verbose, TEXT("Stacking %d of %s onto slot %d (%d/%d)"),
+                AmountToStack, *Item.RegistryKey.ToString(), SlotIndex, StackItem.ItemQuantity, StackItem.StackSize);
+
+            StackItem.ItemQuantity += AmountToStack;
+            Remaining -= AmountToStack;
+
+            SetSlotItem(SlotIndex, StackItem);
+        }
+    }
+
+    // Spill whatever is left into empty slots, one full stack per slot
+    while (Remaining > 0)
+    {
+        bool Success;
+        int32 LocalEmptyIndex;
+        FindEmptySlot(Success, LocalEmptyIndex);
+
+        if (!Success)
+        {
+            break;
+        }
+
+        FItemStructure NewStack = Item;
+        NewStack.ItemQuantity = Item.StackSize > 1 ? FMath::Min(Remaining, Item.StackSize) : Remaining;
+        Remaining -= NewStack.ItemQuantity;
+
+        // Log the item being added with its asset path for debugging
+        UE_LOG(LogInventory, Verbose, TEXT("Adding item to slot %d: Key=%s, Quantity=%d, AssetPath=%s"), 
+            LocalEmptyIndex,
+            *NewStack.RegistryKey.ToString(),
+            NewStack.ItemQuantity,
+            *NewStack.ItemAsset.ToSoftObjectPath().ToString());
+            
+        SetSlotItem(LocalEmptyIndex, NewStack);
+    }
+
+    return Remaining;
+}
+
+
+void UItemContainerBase::OnSlotDrop_Implementation(UItemContainerBase* FromContainer, int32 FromItemIndex,
+                                                   int32 DroppedItemIndex)
+{
+    UE_LOG(LogInventory, Verbose, TEXT("UItemContainerBase::OnSlotDrop: FromContainer=%p, FromItemIndex=%d, DroppedItemIndex=%d"),
+        FromContainer, FromItemIndex, DroppedItemIndex);
+        
+    // Add validation just in case
+    if (!FromContainer)
+    {
+        UE_LOG(LogInventory, Warning, TEXT("OnSlotDrop: FromContainer is null"));
+        return;
+    }
+
+    HandleSlotDrop(FromContainer, FromItemIndex, DroppedItemIndex);
+}
+
+
+
+void UItemContainerBase::HandleSlotDrop(UItemContainerBase* HandleFromContainer, int32 HandleFromItemIndex,
+    int32 HandleDroppedItemIndex)
+{
+    
+}
+
+
+// ================================================ TransferItem ================================================
+bool UItemContainerBase::TransferItem(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToTransfer)
+{
+    // Both ends may be paged out
+    PrepareSlotAccess();
+    if (ToComponent)
+    {
+        ToComponent->PrepareSlotAccess();
+    }
+
+    UE_LOG(LogInventory, Verbose, TEXT("TransferItem: ToComponent=%p, ToSpecificIndex=%d, ItemIndexToTransfer=%d"),
+        ToComponent, ToSpecificIndex, ItemIndexToTransfer);
+        
+    // Early out check - invalid parameters
+    if (!ToComponent || !ToComponent->IsValidLowLevel())
+    {
+        UE_LOG(LogInventory, Warning, TEXT("TransferItem: Invalid receiver component"));
+        return false;
+    }
+    
+    // Check if attempting to move to same slot in same container
+    if (ToComponent == this && ToSpecificIndex == ItemIndexToTransfer)
+    {
+        UE_LOG(LogInventory, Verbose, TEXT("TransferItem: Attempting to move to same slot in same container - ignoring"));
+        return false;
+    }
+
+    if (!ToComponent->Items.IsValidIndex(ToSpecificIndex))
+    {
+        UE_LOG(LogInventory, Warning, TEXT("TransferItem: Invalid destination slot %d"), ToSpecificIndex);
+        return false;
+    }
+    
+    // Get the item to move
+    FItemStructure ItemToMove = GetItemAtIndex(ItemIndexToTransfer);
+    
+    // Validate item exists
+    if (ItemToMove.RegistryKey.IsNone())
+    {
+        UE_LOG(LogInventory, Warning, TEXT("TransferItem: Trying to move an empty item"));
+        return false;
+    }
+    
+    UE_LOG(LogInventory, Verbose, TEXT("Item details - Registry Key: %s, Quantity: %d, Asset Path: %s"),
+        *ItemToMove.RegistryKey.ToString(),
+        ItemToMove.ItemQuantity,
+        ItemToMove.ItemAsset.IsNull() ? TEXT("NULL") : *ItemToMove.ItemAsset.ToSoftObjectPath().ToString());
+
+    // Both slot writes commit together, so neither container ever exposes a half-finished move
+    FItemContainerTransaction Transaction;
+    if (!Transaction.Enlist(this) || !Transaction.Enlist(ToComponent))
+    {
+        UE_LOG(LogInventory, Warning, TEXT("TransferItem: A container is busy in another transaction"));
+        Transaction.Rollback();
+        return false;
+    }
+
+    const FItemStructure EmptyItem;
+    FItemStructure DestinationItem = ToComponent->GetItemAtIndex(ToSpecificIndex);
+    bool bMoved = false;
+    bool bSourceSlotMoved = true;
+    bool bDestinationSlotMoved = false;
+    
+    // Check if destination slot is empty
+    if (ToComponent->IsSlotEmpty(ToSpecificIndex))
+    {
+        bMoved = Transaction.SetSlot(ToComponent, ToSpecificIndex, ItemToMove)
+            && Transaction.SetSlot(this, ItemIndexToTransfer, EmptyItem);
+
+        UE_LOG(LogInventory, Verbose, TEXT("TransferItem: Moving item from slot %d to slot %d"),
+            ItemIndexToTransfer, ToSpecificIndex);
+    }
+    // Check if we should stack the items (same items with stackable property)
+    // Stack size travels with the item, so no asset load is needed to check it
+    else if (ItemToMove.RegistryKey == DestinationItem.RegistryKey
+        && DestinationItem.StackSize > 1
+        && DestinationItem.ItemQuantity < DestinationItem.StackSize)
+    {
+        const int32 MaxStack = DestinationItem.StackSize;
+        const int32 SpaceInStack = MaxStack - DestinationItem.ItemQuantity;
+        const int32 AmountToTransfer = FMath::Min(ItemToMove.ItemQuantity, SpaceInStack);
+
+        UE_LOG(LogInventory, Verbose, TEXT("TransferItem: Stacking %d items onto existing stack of %d (max: %d)"),
+            AmountToTransfer, DestinationItem.ItemQuantity, MaxStack);
+
+        // Update destination stack, then the source stack or clear it if completely transferred
+        DestinationItem.ItemQuantity += AmountToTransfer;
+        ItemToMove.ItemQuantity -= AmountToTransfer;
+
+        bMoved = Transaction.SetSlot(ToComponent, ToSpecificIndex, DestinationItem)
+            && Transaction.SetSlot(this, ItemIndexToTransfer, ItemToMove.ItemQuantity > 0 ? ItemToMove : EmptyItem);
+        bSourceSlotMoved = ItemToMove.ItemQuantity <= 0;
+
+        UE_LOG(LogInventory, Verbose, TEXT("TransferItem: %d items left in the source stack"), ItemToMove.ItemQuantity);
+    }
+    else
+    {
+        // Otherwise swap the two slots
+        UE_LOG(LogInventory, Verbose, TEXT("TransferItem: Swapping items between slots - Source: %s, Destination: %s"),
+            *ItemToMove.RegistryKey.ToString(), *DestinationItem.RegistryKey.ToString());
+
+        bMoved = Transaction.SetSlot(ToComponent, ToSpecificIndex, ItemToMove)
+            && Transaction.SetSlot(this, ItemIndexToTransfer, DestinationItem);
+        bDestinationSlotMoved = true;
+    }
+
+    if (!bMoved)
+    {
+        UE_LOG(LogInventory, Warning, TEXT("TransferItem: Failed to write slot %d -> %d, rolling back"),
+            ItemIndexToTransfer, ToSpecificIndex);
+        Transaction.Rollback();
+        return false;
+    }
+
+    // Lets slot references follow whole stacks; items leaving a container map to INDEX_NONE.
+    // A swap within one container goes out as one map so both references move together.
+    // Sent before the commit's slot notifications, so an emptied slot's references have already moved on.
+    const bool bSameContainer = ToComponent == this;
+    TMap<int32, int32> MovedSlots;
+    if (bSourceSlotMoved)
+    {
+        MovedSlots.Add(ItemIndexToTransfer, bSameContainer ? ToSpecificIndex : INDEX_NONE);
+    }
+    if (bDestinationSlotMoved && bSameContainer)
+    {
+        MovedSlots.Add(ToSpecificIndex, ItemIndexToTransfer);
+    }
+    if (!MovedSlots.IsEmpty())
+    {
+        OnSlotsMoved.Broadcast(MovedSlots);
+    }
+    if (bDestinationSlotMoved && !bSameContainer)
+    {
+        ToComponent->OnSlotsMoved.Broadcast(TMap<int32, int32>{ { ToSpecificIndex, INDEX_NONE } });
+    }
+
+    // Sends one change set per container
+    Transaction.Commit();
+    return true;
+}
+
+bool UItemContainerBase::TransferItemQuantity(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToTransfer, int32 Quantity)
+{
+    if (!IsValid(ToComponent) || !ToComponent->Items.IsValidIndex(ToSpecificIndex) || Quantity <= 0)
+    {
+        return false;
+    }
+
+    if (ToComponent == this && ToSpecificIndex == ItemIndexToTransfer)
+    {
+        return false;
+    }
+
+    FItemStructure SourceItem = GetItemAtIndex(ItemIndexToTransfer);
+    if (SourceItem.IsEmpty() || Quantity > SourceItem.ItemQuantity)
+    {
+        return false;
+    }
+
+    if (Quantity == SourceItem.ItemQuantity)
+    {
+        return TransferItem(ToComponent, ToSpecificIndex, ItemIndexToTransfer);
+    }
+
+    if (ToComponent->IsSlotEmpty(ToSpecificIndex))
+    {
+        return SplitStack(ToComponent, ToSpecificIndex, ItemIndexToTransfer, Quantity);
+    }
+
+    // All or nothing onto an existing stack
+    const FItemStructure DestinationItem = ToComponent->GetItemAtIndex(ToSpecificIndex);
+    if (DestinationItem.RegistryKey != SourceItem.RegistryKey
+        || DestinationItem.ItemQuantity + Quantity > DestinationItem.StackSize)
+    {
+        return false;
+    }
+
+    return MergeStack(ToComponent, ToSpecificIndex, ItemIndexToTransfer, Quantity) == Quantity;
+}
+
+
+// ================================================ SplitStack ================================================
+bool UItemContainerBase::SplitStack(UItemContainerBase* ToComponent, int32 ToSpecificIndex, const int32 ItemIndexToSplit, const int32 Quantity)
+{
+    // Both ends may be paged out
+    PrepareSlotAccess();
+    if (ToComponent)
+    {
+        ToComponent->PrepareSlotAccess();
+    }
+
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        Server_SplitStack(ToComponent, ToSpecificIndex, ItemIndexToSplit, Quantity);
+        return false;
+    }
+
+    if (!IsValid(ToComponent))
+    {
+        UE_LOG(LogInventory, Warning, TEXT("SplitStack: Invalid receiver component"));
+        return false;
+    }
+
+    FItemStructure SourceItem = GetItemAtIndex(ItemIndexToSplit);
+    if (SourceItem.IsEmpty() || Quantity <= 0 || Quantity >= SourceItem.ItemQuantity)
+    {
+        UE_LOG(LogInventory, Verbose, TEXT("SplitStack: Can't take %d from slot %d holding %d"),
+            Quantity, ItemIndexToSplit, SourceItem.ItemQuantity);
+        return false;
+    }
+
+    if (ToSpecificIndex == INDEX_NONE)
+    {
+        bool bFoundEmptySlot = false;
+        ToComponent->FindEmptySlot(bFoundEmptySlot, ToSpecificIndex);
+        if (!bFoundEmptySlot)
+        {
+            return false;
+        }
+    }
+
+    if (!ToComponent->Items.IsValidIndex(ToSpecificIndex) || !ToComponent->IsSlotEmpty(ToSpecificIndex))
+    {
+        UE_LOG(LogInventory, Verbose, TEXT("SplitStack: Destination slot %d is not an empty slot"), ToSpecificIndex);
+        return false;
+    }
+
+    FItemStructure SplitItem = SourceItem;
+    SplitItem.ItemQuantity = Quantity;
+    SourceItem.ItemQuantity -= Quantity;
+
+    // One slot write per side, committed as one change set per container
+    FItemContainerTransaction Transaction;
+    const bool bSplit = Transaction.Enlist(this) && Transaction.Enlist(ToComponent)
+        && Transaction.SetSlot(ToComponent, ToSpecificIndex, SplitItem)
+        && Transaction.SetSlot(this, ItemIndexToSplit, SourceItem);
+
+    if (!bSplit)
+    {
+        Transaction.Rollback();
+        return false;
+    }
+
+    Transaction.Commit();
+
+    UE_LOG(LogInventory, Verbose, TEXT("SplitStack: Moved %d of %s from slot %d to slot %d"),
+        Quantity, *SplitItem.RegistryKey.ToString(), ItemIndexToSplit, ToSpecificIndex);
+    return true;
+}
+
+void UItemContainerBase::Server_SplitStack_Implementation(UItemContainerBase* ToComponent, const int32 ToSpecificIndex, const int32 ItemIndexToSplit, const int32 Quantity)
+{
+    if (!CanOwnerReach(ToComponent))
+    {
+        UE_LOG(LogInventory, Warning, TEXT("Server_SplitStack: %s is not reachable from %s"), *GetNameSafe(ToComponent), *GetName());
+        return;
+    }
+
+    SplitStack(ToComponent, ToSpecificIndex, ItemIndexToSplit, Quantity);
+}
+
+
+// ================================================ MergeStack ================================================
+int32 UItemContainerBase::MergeStack(UItemContainerBase* ToComponent, const int32 ToSpecificIndex, const int32 ItemIndexToMerge, const int32 Quantity)
+{
+    // Both ends may be paged out
+    PrepareSlotAccess();
+    if (ToComponent)
+    {
+        ToComponent->PrepareSlotAccess();
+    }
+
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        Server_MergeStack(ToComponent, ToSpecificIndex, ItemIndexToMerge, Quantity);
+        return 0;
+    }
+
+    if (!IsValid(ToComponent))
+    {
+        UE_LOG(LogInventory, Warning, TEXT("MergeStack: Invalid receiver component"));
+        return 0;
+    }
+
+    if (ToComponent == this && ToSpecificIndex == ItemIndexToMerge)
+    {
+        return 0;
+    }
+
+    FItemStructure SourceItem = GetItemAtIndex(ItemIndexToMerge);
+    if (SourceItem.IsEmpty() || Quantity < 0)
+    {
+        return 0;
+    }
+
+    int32 Remaining = Quantity == 0 ? SourceItem.ItemQuantity : FMath::Min(Quantity, SourceItem.ItemQuantity);
+
+    // Destination stacks in slot order; the source never tops up itself
+    TArray<int32> TargetSlots;
+    if (ToSpecificIndex == INDEX_NONE)
+    {
+        if (const TArray<int32>* PartialSlots = ToComponent->PartialStackSlots.Find(SourceItem.RegistryKey))
+        {
+            TargetSlots = *PartialSlots;
+            if (ToComponent == this)
+            {
+                TargetSlots.Remove(ItemIndexToMerge);
+            }
+        }
+    }
+    else if (ToComponent->Items.IsValidIndex(ToSpecificIndex))
+    {
+        TargetSlots.Add(ToSpecificIndex);
+    }
+
+    FItemContainerTransaction Transaction;
+    if (!Transaction.Enlist(this) || !Transaction.Enlist(ToComponent))
+    {
+        Transaction.Rollback();
+        return 0;
+    }
+
+    int32 Moved = 0;
+    for (const int32 SlotIndex : TargetSlots)
+    {
+        if (Remaining <= 0)
+        {
+            break;
+        }
+
+        FItemStructure DestinationItem = ToComponent->GetItemAtIndex(SlotIndex);
+        if (DestinationItem.RegistryKey != SourceItem.RegistryKey)
+        {
+            continue;
+        }
+
+        const int32 AmountToStack = FMath::Min(Remaining, DestinationItem.StackSize - DestinationItem.ItemQuantity);
+        if (AmountToStack <= 0)
+        {
+            continue;
+        }
+
+        DestinationItem.ItemQuantity += AmountToStack;
+        if (!Transaction.SetSlot(ToComponent, SlotIndex, DestinationItem))
+        {
+            Transaction.Rollback();
+            return 0;
+        }
+
+        Remaining -= AmountToStack;
+        Moved += AmountToStack;
+    }
+
+    if (Moved == 0)
+    {
+        Transaction.Rollback();
+        return 0;
+    }
+
+    SourceItem.ItemQuantity -= Moved;
+    if (!Transaction.SetSlot(this, ItemIndexToMerge, SourceItem.ItemQuantity > 0 ? SourceItem : FItemStructure()))
+    {
+        Transaction.Rollback();
+        return 0;
+    }
+
+    Transaction.Commit();
+
+    UE_LOG(LogInventory, Verbose, TEXT("MergeStack: Moved %d of %s out of slot %d (%d left)"),
+        Moved, *SourceItem.RegistryKey.ToString(), ItemIndexToMerge, SourceItem.ItemQuantity);
+    return Moved;
+}
+
+void UItemContainerBase::Server_MergeStack_Implementation(UItemContainerBase* ToComponent, const int32 ToSpecificIndex, const int32 ItemIndexToMerge, const int32 Quantity)
+{
+    if (!CanOwnerReach(ToComponent))
+    {
+        UE_LOG(LogInventory, Warning, TEXT("Server_MergeStack: %s is not reachable from %s"), *GetNameSafe(ToComponent), *GetName());
+        return;
+    }
+
+    MergeStack(ToComponent, ToSpecificIndex, ItemIndexToMerge, Quantity);
+}
+
+
+// ================================================ IsSlotEmpty ================================================
+bool UItemContainerBase::IsSlotEmpty(int32 SlotIndex) const
+{
+    PrepareSlotAccess();
+
+    // Out of range slots and bits not received yet both read as empty
+    return !OccupiedSlots.IsValidIndex(SlotIndex) || !OccupiedSlots[SlotIndex];
+}
+
+
+// ================================================ GetItemAtIndex ================================================
+FItemStructure UItemContainerBase::GetItemAtIndex(int32 Index) const
+{
+    PrepareSlotAccess();
+
+    int32 LocalIndex = Index;
+
+    if (Items.IsValidIndex(LocalIndex))
+    {
+        // Built from the slot store; slots a client hasn't received yet come back empty
+        const FItemStructure Item = SlotStore.MakeItem(LocalIndex);
+
+        UE_LOG(LogInventory, VeryVerbose, TEXT("GetItemAtIndex: Index %d contains item with key %s"),
+            LocalIndex, *Item.RegistryKey.ToString());
+        
+        return Item;
+    }
+    else
+    {
+        SURVIVAL_LOG_RATELIMITED(LogInventory, Warning, 1.0, TEXT("GetItemAtIndex: Invalid index %d (array size: %d)"),
+            LocalIndex, Items.Num());
+        return FItemStructure();
+    }
+}
+
+
+// ================================================ CountItem ================================================
+int32 UItemContainerBase::CountItem(const FName RegistryKey) const
+{
+    PrepareSlotAccess();
+
+    const int32* Count = ItemCounts.Find(RegistryKey);
+    return Count ? *Count : 0;
+}
+
+
+// ================================================ AddItemToIndex ================================================
+void UItemContainerBase::AddItemToIndex(const FItemStructure& ItemInfo, int32 LocalSpecificIndex, int32 LocalItemIndex, bool& Success)
+{
+    PrepareSlotAccess();
+
+    const FItemStructure& LocalItem = ItemInfo;
+    int32 LocalIndex = LocalSpecificIndex;
+    int32 LocalFromIndex = LocalItemIndex;
+
+    UE_LOG(LogInventory, Verbose, TEXT("AddItemToIndex: ItemKey=%s, LocalIndex=%d, LocalFromIndex=%d"),
+        *ItemInfo.RegistryKey.ToString(), LocalIndex, LocalFromIndex);
+
+    Success = false;
+    
+    if (IsSlotEmpty(LocalIndex))
+    {
+        if (Items.IsValidIndex(LocalIndex))
+        {
+            SetSlotItem(LocalIndex, LocalItem);
+            
+            Success = true;
+            UE_LOG(LogInventory, Verbose, TEXT("AddItemToIndex: Successfully added item to slot %d"), LocalIndex);
+        }
+        else
+        {
+            UE_LOG(LogInventory, Warning, TEXT("AddItemToIndex: Invalid slot index %d"), LocalIndex);
+        }
+    }
+    else
+    {
+        UE_LOG(LogInventory, Warning, TEXT("AddItemToIndex: Slot %d is not empty!"), LocalIndex);
+    }
+}
+
+// ================================================ RemoveItemAtIndex ================================================
+void UItemContainerBase::RemoveItemAtIndex(int32 RemovedIndex, bool& Success)
+{
+    PrepareSlotAccess();
+
+    if (Items.IsValidIndex(RemovedIndex))
+    {
+        // Create empty item and assign it to the slot
+        FItemStructure EmptyItem;
+        SetSlotItem(RemovedIndex, EmptyItem);
         
         Success = true;
-        UE_LOG(LogTemp, Log, TEXT("RemoveItemAtIndex: Successfully removed item at index %d"), RemovedIndex);
+        UE_LOG(LogInventory, Verbose, TEXT("RemoveItemAtIndex: Successfully removed item at index %d"), RemovedIndex);
     }
     else
     {
         Success = false;
-        UE_LOG(LogTemp, Warning, TEXT("RemoveItemAtIndex: Invalid index %d"), RemovedIndex);
+        UE_LOG(LogInventory, Warning, TEXT("RemoveItemAtIndex: Invalid index %d"), RemovedIndex);
     }
 }
 
@@ -577,12 +1845,12 @@ void UItemContainerBase::RemoveItemAtIndex(int32 RemovedIndex, bool& Success)
 
 void UItemContainerBase::PrintInventoryContents()
 {
-    UE_LOG(LogTemp, Log, TEXT("==== INVENTORY CONTENTS (%d slots) ===="), Items.Num());
+    UE_LOG(LogInventory, Log, TEXT("==== INVENTORY CONTENTS (%d slots) ===="), Items.Num());
     for (int32 i = 0; i < Items.Num(); i++)
     {
         if (!Items[i].RegistryKey.IsNone())
         {
-            UE_LOG(LogTemp, Log, TEXT("Slot %d: Item=%s, Quantity=%d, Path=%s"),
+            UE_LOG(LogInventory, Log, TEXT("Slot %d: Item=%s, Quantity=%d, Path=%s"),
                 i,
                 *Items[i].RegistryKey.ToString(),
                 Items[i].ItemQuantity,
@@ -590,7 +1858,7 @@ void UItemContainerBase::PrintInventoryContents()
         }
         else
         {
-            UE_LOG(LogTemp, Log, TEXT("Slot %d: [EMPTY]"), i);
+            UE_LOG(LogInventory, Log, TEXT("Slot %d: [EMPTY]"), i);
         }
     }
 }
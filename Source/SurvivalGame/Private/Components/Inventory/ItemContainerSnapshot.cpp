@@ -0,0 +1,451 @@
+// ItemContainerSnapshot.cpp
+
+#include "Components/Inventory/ItemContainerSnapshot.h"
+
+#include "Components/Inventory/ItemContainerBase.h"
+#include "Core/SurvivalAssetManager.h"
+#include "Core/SurvivalLog.h"
+
+namespace ItemContainerSnapshotFormat
+{
+    /** Optional record fields; a cleared flag means the FItemStructure default */
+    enum EFlags : uint8
+    {
+        HasQuantity   = 1 << 0,
+        HasStackSize  = 1 << 1,
+        HasHP         = 1 << 2,
+        HasAmmo       = 1 << 3,
+    };
+
+    /** Version 1 writes no extra header bytes */
+    constexpr uint32 ExtraHeaderBytes = 0;
+
+    /** Longest LEB128 encoding of a 64-bit value */
+    constexpr int32 MaxVarintBytes = 10;
+
+    /** Smallest encodings, used to bound counts read from the buffer: two empty strings, and length + gap + id + flags */
+    constexpr int32 MinIdBytes = 2;
+    constexpr int32 MinRecordBytes = 4;
+
+    static void WriteVarint(TArray<uint8>& Out, uint64 Value)
+    {
+        do
+        {
+            uint8 Byte = static_cast<uint8>(Value & 0x7F);
+            Value >>= 7;
+            if (Value != 0)
+            {
+                Byte |= 0x80;
+            }
+            Out.Add(Byte);
+        }
+        while (Value != 0);
+    }
+
+    static void WriteSignedVarint(TArray<uint8>& Out, const int32 Value)
+    {
+        // Zigzag so small negative values stay small
+        WriteVarint(Out, static_cast<uint32>((Value << 1) ^ (Value >> 31)));
+    }
+
+    static void WriteFloat(TArray<uint8>& Out, const float Value)
+    {
+        // Raw bits keep durability exact across a round trip
+        const uint32 Bits = BitCast<uint32>(Value);
+        for (int32 Shift = 0; Shift < 32; Shift += 8)
+        {
+            Out.Add(static_cast<uint8>(Bits >> Shift));
+        }
+    }
+
+    static void WriteString(TArray<uint8>& Out, const FString& Value)
+    {
+        const FTCHARToUTF8 Utf8(*Value);
+        WriteVarint(Out, static_cast<uint64>(Utf8.Length()));
+        Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+}
+
+//===========================================Write====================================================
+void FItemContainerSnapshot::Write(const UItemContainerBase& Container, TArray<uint8>& OutBytes)
+{
+    const FItemSlotStore& Store = Container.GetSlotStore();
+    Write(Store, 0, Store.Num(), OutBytes);
+}
+
+void FItemContainerSnapshot::Write(const FItemSlotStore& Store, const int32 FirstSlot, const int32 NumSlots, TArray<uint8>& OutBytes)
+{
+    using namespace ItemContainerSnapshotFormat;
+
+    const FItemStructure Defaults;
+    const int32 EndSlot = FMath::Min(FirstSlot + NumSlots, Store.Num());
+
+    // Collect the distinct items first; the table has to precede the records
+    TArray<int32, TInlineAllocator<128>> OccupiedSlots;
+    TMap<FName, int32> IdByKey;
+    TArray<FItemStructure> IdItems;
+
+    for (int32 SlotIndex = FirstSlot; SlotIndex < EndSlot; ++SlotIndex)
+    {
+        const FName RegistryKey = Store.GetRegistryKey(SlotIndex);
+        if (RegistryKey.IsNone() || Store.GetQuantity(SlotIndex) <= 0)
+        {
+            continue;
+        }
+
+        OccupiedSlots.Add(SlotIndex);
+        if (!IdByKey.Contains(RegistryKey))
+        {
+            IdByKey.Add(RegistryKey, IdItems.Num());
+            IdItems.Add(Store.MakeItem(SlotIndex));
+        }
+    }
+
+    // Header
+    for (int32 Shift = 0; Shift < 32; Shift += 8)
+    {
+        OutBytes.Add(static_cast<uint8>(Magic >> Shift));
+    }
+    OutBytes.Add(SchemaVersion);
+    OutBytes.Add(SchemaVersion); // MinReaderVersion: every change so far is additive
+    WriteVarint(OutBytes, ExtraHeaderBytes);
+    WriteVarint(OutBytes, static_cast<uint64>(FMath::Max(NumSlots, 0)));
+
+    // Id table
+    WriteVarint(OutBytes, static_cast<uint64>(IdItems.Num()));
+    for (const FItemStructure& IdItem : IdItems)
+    {
+        WriteString(OutBytes, IdItem.RegistryKey.ToString());
+        WriteString(OutBytes, IdItem.ItemAsset.ToSoftObjectPath().ToString());
+    }
+
+    // Sparse slot records
+    WriteVarint(OutBytes, static_cast<uint64>(OccupiedSlots.Num()));
+
+    TArray<uint8, TInlineAllocator<64>> Record;
+    int32 PreviousSlot = FirstSlot - 1;
+
+    for (const int32 SlotIndex : OccupiedSlots)
+    {
+        const FItemStructure Item = Store.MakeItem(SlotIndex);
+
+        uint8 Flags = 0;
+        Flags |= Item.ItemQuantity != Defaults.ItemQuantity ? HasQuantity : 0;
+        Flags |= Item.StackSize != Defaults.StackSize ? HasStackSize : 0;
+        Flags |= (Item.CurrentHP != Defaults.CurrentHP || Item.MaxHP != Defaults.MaxHP) ? HasHP : 0;
+        Flags |= (Item.CurrentAmmo != Defaults.CurrentAmmo || Item.MaxAmmo != Defaults.MaxAmmo) ? HasAmmo : 0;
+
+        Record.Reset();
+        WriteVarint(Record, static_cast<uint64>(SlotIndex - PreviousSlot - 1));
+        WriteVarint(Record, static_cast<uint64>(IdByKey.FindChecked(Item.RegistryKey)));
+        Record.Add(Flags);
+
+        if (Flags & HasQuantity)
+        {
+            WriteSignedVarint(Record, Item.ItemQuantity);
+        }
+        if (Flags & HasStackSize)
+        {
+            WriteSignedVarint(Record, Item.StackSize);
+        }
+        if (Flags & HasHP)
+        {
+            WriteFloat(Record, Item.CurrentHP);
+            WriteFloat(Record, Item.MaxHP);
+        }
+        if (Flags & HasAmmo)
+        {
+            WriteSignedVarint(Record, Item.CurrentAmmo);
+            WriteSignedVarint(Record, Item.MaxAmmo);
+        }
+
+        // Length prefix lets older readers skip fields appended by newer versions
+        WriteVarint(OutBytes, static_cast<uint64>(Record.Num()));
+        OutBytes.Append(Record);
+
+        PreviousSlot = SlotIndex;
+    }
+
+    UE_LOG(LogInventory, Verbose, TEXT("FItemContainerSnapshot::Write: %d records, %d ids, %d bytes"),
+        OccupiedSlots.Num(), IdItems.Num(), OutBytes.Num());
+}
+
+//===========================================Reader====================================================
+FItemContainerSnapshotReader::FItemContainerSnapshotReader(const TConstArrayView<uint8> InBuffer)
+    : Buffer(InBuffer)
+{
+    ReadHeader();
+}
+
+bool FItemContainerSnapshotReader::ReadHeader()
+{
+    using namespace ItemContainerSnapshotFormat;
+
+    uint32 ReadMagic = 0;
+    for (int32 Shift = 0; Shift < 32; Shift += 8)
+    {
+        uint8 Byte = 0;
+        if (!ReadByte(Byte))
+        {
+            return false;
+        }
+        ReadMagic |= static_cast<uint32>(Byte) << Shift;
+    }
+
+    if (ReadMagic != FItemContainerSnapshot::Magic)
+    {
+        return Fail(TEXT("not a container snapshot"));
+    }
+
+    uint8 MinReaderVersion = 0;
+    if (!ReadByte(Version) || !ReadByte(MinReaderVersion))
+    {
+        return false;
+    }
+
+    if (Version < FItemContainerSnapshot::OldestReadableVersion)
+    {
+        // Decoding it with the current layout would silently misplace fields
+        UE_LOG(LogInventory, Error, TEXT("FItemContainerSnapshotReader: Schema version %d is older than the oldest readable version %d"),
+            Version, FItemContainerSnapshot::OldestReadableVersion);
+        bError = true;
+        return false;
+    }
+
+    if (MinReaderVersion > FItemContainerSnapshot::SchemaVersion)
+    {
+        return Fail(TEXT("snapshot needs a newer reader"));
+    }
+
+    // Header fields added after this version
+    int32 ExtraHeaderBytes = 0;
+    const uint8* ExtraHeader = nullptr;
+    if (!ReadVarint32(ExtraHeaderBytes) || !ReadBytes(ExtraHeaderBytes, ExtraHeader))
+    {
+        return false;
+    }
+
+    int32 IdCount = 0;
+    if (!ReadVarint32(SlotCount) || !ReadVarint32(IdCount))
+    {
+        return false;
+    }
+
+    // Checked before reserving, so a corrupt count fails as malformed instead of allocating gigabytes
+    if (IdCount > (Buffer.Num() - Offset) / MinIdBytes)
+    {
+        return Fail(TEXT("id count larger than the buffer"));
+    }
+
+    Ids.Reserve(IdCount);
+    for (int32 IdIndex = 0; IdIndex < IdCount; ++IdIndex)
+    {
+        int32 KeyLength = 0;
+        const uint8* KeyData = nullptr;
+        FIdEntry& Entry = Ids.AddDefaulted_GetRef();
+
+        if (!ReadVarint32(KeyLength) || !ReadBytes(KeyLength, KeyData)
+            || !ReadVarint32(Entry.PathLength) || !ReadBytes(Entry.PathLength, Entry.PathData))
+        {
+            return false;
+        }
+
+        Entry.RegistryKey = FName(KeyLength, reinterpret_cast<const UTF8CHAR*>(KeyData));
+    }
+
+    if (!ReadVarint32(RecordCount))
+    {
+        return false;
+    }
+
+    if (RecordCount > (Buffer.Num() - Offset) / MinRecordBytes)
+    {
+        return Fail(TEXT("record count larger than the buffer"));
+    }
+
+    return true;
+}
+
+bool FItemContainerSnapshotReader::Next(int32& OutSlotIndex, FItemStructure& OutItem)
+{
+    using namespace ItemContainerSnapshotFormat;
+
+    if (bError || RecordsRead >= RecordCount)
+    {
+        return false;
+    }
+
+    int32 RecordLength = 0;
+    if (!ReadVarint32(RecordLength))
+    {
+        return false;
+    }
+
+    const int32 RecordEnd = Offset + RecordLength;
+    if (RecordEnd > Buffer.Num())
+    {
+        return Fail(TEXT("record past the end of the buffer"));
+    }
+
+    int32 SlotGap = 0;
+    int32 IdIndex = 0;
+    uint8 Flags = 0;
+    if (!ReadVarint32(SlotGap) || !ReadVarint32(IdIndex) || !ReadByte(Flags))
+    {
+        return false;
+    }
+
+    if (!Ids.IsValidIndex(IdIndex))
+    {
+        return Fail(TEXT("record refers to a missing id"));
+    }
+
+    if (SlotGap > MAX_int32 - 1 - PreviousSlot)
+    {
+        return Fail(TEXT("slot index out of range"));
+    }
+
+    const FItemStructure Defaults;
+    OutItem = Defaults;
+
+    if ((Flags & HasQuantity) && !ReadSignedVarint(OutItem.ItemQuantity))
+    {
+        return false;
+    }
+    if ((Flags & HasStackSize) && !ReadSignedVarint(OutItem.StackSize))
+    {
+        return false;
+    }
+    if ((Flags & HasHP) && !(ReadFloat(OutItem.CurrentHP) && ReadFloat(OutItem.MaxHP)))
+    {
+        return false;
+    }
+    if ((Flags & HasAmmo) && !(ReadSignedVarint(OutItem.CurrentAmmo) && ReadSignedVarint(OutItem.MaxAmmo)))
+    {
+        return false;
+    }
+
+    // Every version from OldestReadableVersion on shares this record layout, so there is nothing to upgrade
+
+    if (Offset > RecordEnd)
+    {
+        return Fail(TEXT("record longer than its length prefix"));
+    }
+
+    // Skip fields written by newer versions
+    Offset = RecordEnd;
+
+    const FIdEntry& Id = Ids[IdIndex];
+    OutItem.RegistryKey = Id.RegistryKey;
+
+    // Prefer the index so the stored path is only parsed for unindexed items
+    const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+    FSoftObjectPath AssetPath = AssetManager ? AssetManager->FindItemAssetPath(Id.RegistryKey) : FSoftObjectPath();
+    if (AssetPath.IsNull() && Id.PathLength > 0)
+    {
+        AssetPath = FSoftObjectPath(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Id.PathData), Id.PathLength));
+    }
+    OutItem.ItemAsset = TSoftObjectPtr<UItemInfo>(AssetPath);
+
+    OutSlotIndex = PreviousSlot + 1 + SlotGap;
+    PreviousSlot = OutSlotIndex;
+    ++RecordsRead;
+    return true;
+}
+
+bool FItemContainerSnapshotReader::ReadByte(uint8& OutValue)
+{
+    if (bError || Offset >= Buffer.Num())
+    {
+        return Fail(TEXT("unexpected end of buffer"));
+    }
+
+    OutValue = Buffer[Offset++];
+    return true;
+}
+
+bool FItemContainerSnapshotReader::ReadVarint(uint64& OutValue)
+{
+    OutValue = 0;
+    for (int32 ByteIndex = 0; ByteIndex < ItemContainerSnapshotFormat::MaxVarintBytes; ++ByteIndex)
+    {
+        uint8 Byte = 0;
+        if (!ReadByte(Byte))
+        {
+            return false;
+        }
+
+        OutValue |= static_cast<uint64>(Byte & 0x7F) << (7 * ByteIndex);
+        if (!(Byte & 0x80))
+        {
+            return true;
+        }
+    }
+
+    return Fail(TEXT("varint too long"));
+}
+
+bool FItemContainerSnapshotReader::ReadVarint32(int32& OutValue)
+{
+    uint64 Value = 0;
+    if (!ReadVarint(Value))
+    {
+        return false;
+    }
+
+    if (Value > static_cast<uint64>(MAX_int32))
+    {
+        return Fail(TEXT("count out of range"));
+    }
+
+    OutValue = static_cast<int32>(Value);
+    return true;
+}
+
+bool FItemContainerSnapshotReader::ReadSignedVarint(int32& OutValue)
+{
+    uint64 Value = 0;
+    if (!ReadVarint(Value))
+    {
+        return false;
+    }
+
+    const uint32 Zigzag = static_cast<uint32>(Value);
+    OutValue = static_cast<int32>(Zigzag >> 1) ^ -static_cast<int32>(Zigzag & 1);
+    return true;
+}
+
+bool FItemContainerSnapshotReader::ReadFloat(float& OutValue)
+{
+    const uint8* Data = nullptr;
+    if (!ReadBytes(4, Data))
+    {
+        return false;
+    }
+
+    const uint32 Bits = Data[0] | Data[1] << 8 | Data[2] << 16 | static_cast<uint32>(Data[3]) << 24;
+    OutValue = BitCast<float>(Bits);
+    return true;
+}
+
+bool FItemContainerSnapshotReader::ReadBytes(const int32 Length, const uint8*& OutData)
+{
+    if (bError || Length < 0 || Length > Buffer.Num() - Offset)
+    {
+        return Fail(TEXT("unexpected end of buffer"));
+    }
+
+    OutData = Buffer.GetData() + Offset;
+    Offset += Length;
+    return true;
+}
+
+bool FItemContainerSnapshotReader::Fail(const TCHAR* Reason)
+{
+    if (!bError)
+    {
+        bError = true;
+        UE_LOG(LogInventory, Warning, TEXT("FItemContainerSnapshotReader: Malformed snapshot at byte %d: %s"), Offset, Reason);
+    }
+    return false;
+}
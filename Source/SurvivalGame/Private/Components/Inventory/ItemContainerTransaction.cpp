@@ -0,0 +1,130 @@
+// ItemContainerTransaction.cpp
+
+#include "Components/Inventory/ItemContainerTransaction.h"
+
+#include "Components/Inventory/ItemContainerBase.h"
+#include "Core/SurvivalLog.h"
+
+FItemContainerTransaction::~FItemContainerTransaction()
+{
+    if (bOpen)
+    {
+        Rollback();
+    }
+}
+
+//===========================================Enlist====================================================
+bool FItemContainerTransaction::Enlist(UItemContainerBase* Container)
+{
+    if (!bOpen || !IsValid(Container))
+    {
+        return false;
+    }
+
+    if (Container->ActiveTransaction == this)
+    {
+        return true;
+    }
+
+    if (Container->ActiveTransaction)
+    {
+        UE_LOG(LogInventory, Warning, TEXT("FItemContainerTransaction: %s is already part of another transaction"), *Container->GetName());
+        return false;
+    }
+
+    FParticipant& Participant = Participants.AddDefaulted_GetRef();
+    Participant.Container = Container;
+    Participant.PendingSlotMark = Container->PendingBatchSlots.Num();
+
+    Container->ActiveTransaction = this;
+    Container->BeginSlotBatch();
+    return true;
+}
+
+//===========================================SetSlot====================================================
+bool FItemContainerTransaction::SetSlot(UItemContainerBase* Container, const int32 SlotIndex, const FItemStructure& Item)
+{
+    if (!Enlist(Container) || !Container->Items.IsValidIndex(SlotIndex))
+    {
+        return false;
+    }
+
+    // SetSlotItem journals the previous contents through RecordWrite
+    Container->SetSlotItem(SlotIndex, Item);
+    return true;
+}
+
+void FItemContainerTransaction::RecordWrite(UItemContainerBase* Container, const int32 SlotIndex, const FItemStructure& PreviousItem)
+{
+    FJournalEntry& Entry = Journal.AddDefaulted_GetRef();
+    Entry.Container = Container;
+    Entry.SlotIndex = SlotIndex;
+    Entry.PreviousItem = PreviousItem;
+}
+
+//===========================================Commit====================================================
+void FItemContainerTransaction::Commit()
+{
+    if (!bOpen)
+    {
+        return;
+    }
+
+    bOpen = false;
+
+    for (const FParticipant& Participant : Participants)
+    {
+        if (UItemContainerBase* Container = Participant.Container.Get())
+        {
+            Container->ActiveTransaction = nullptr;
+            Container->EndSlotBatch();
+        }
+    }
+
+    Journal.Reset();
+    Participants.Reset();
+}
+
+//===========================================Rollback====================================================
+void FItemContainerTransaction::Rollback()
+{
+    if (!bOpen)
+    {
+        return;
+    }
+
+    bOpen = false;
+
+    // Detach first so the restoring writes below aren't journaled again
+    for (const FParticipant& Participant : Participants)
+    {
+        if (UItemContainerBase* Container = Participant.Container.Get())
+        {
+            Container->ActiveTransaction = nullptr;
+        }
+    }
+
+    // Undo newest to oldest so every slot ends at its pre-transaction value
+    for (int32 EntryIndex = Journal.Num() - 1; EntryIndex >= 0; --EntryIndex)
+    {
+        const FJournalEntry& Entry = Journal[EntryIndex];
+        if (UItemContainerBase* Container = Entry.Container.Get())
+        {
+            Container->SetSlotItem(Entry.SlotIndex, Entry.PreviousItem);
+        }
+    }
+
+    // Nothing changed from the outside, so drop the notifications queued by this transaction
+    for (const FParticipant& Participant : Participants)
+    {
+        if (UItemContainerBase* Container = Participant.Container.Get())
+        {
+            Container->CancelSlotBatch(Participant.PendingSlotMark);
+        }
+    }
+
+    UE_LOG(LogInventory, Log, TEXT("FItemContainerTransaction: Rolled back %d slot writes"), Journal.Num());
+
+    Journal.Reset();
+    Participants.Reset();
+}
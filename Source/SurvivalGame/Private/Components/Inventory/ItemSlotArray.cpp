@@ -0,0 +1,99 @@
+// ItemSlotArray.cpp
+
+#include "Components/Inventory/ItemSlotArray.h"
+
+#include "Components/Inventory/ItemContainerBase.h"
+
+//===========================================FItemSlotEntry====================================================
+void FItemSlotEntry::PostReplicatedAdd(const FItemSlotArray& InArraySerializer)
+{
+    // Initial empty slots don't need a UI refresh
+    if (!Item.IsEmpty())
+    {
+        InArraySerializer.NotifySlotReplicated(SlotIndex);
+    }
+}
+
+void FItemSlotEntry::PostReplicatedChange(const FItemSlotArray& InArraySerializer)
+{
+    InArraySerializer.NotifySlotReplicated(SlotIndex);
+}
+
+void FItemSlotEntry::PreReplicatedRemove(const FItemSlotArray& InArraySerializer)
+{
+    // Entries are never removed on the server, but treat a removal as the slot being cleared
+    Item = FItemStructure();
+    InArraySerializer.NotifySlotReplicated(SlotIndex);
+}
+
+//===========================================FItemSlotArray====================================================
+void FItemSlotArray::Init(UItemContainerBase* InOwner, int32 NumSlots)
+{
+    Owner = InOwner;
+
+    // Releasing a container frees its entries instead of keeping the capacity around
+    if (NumSlots <= 0)
+    {
+        Entries.Empty();
+        MarkArrayDirty();
+        return;
+    }
+
+    Entries.SetNum(NumSlots);
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        Entries[Index].SlotIndex = Index;
+        Entries[Index].Item = FItemStructure();
+        MarkItemDirty(Entries[Index]);
+    }
+
+    MarkArrayDirty();
+}
+
+int32 FItemSlotArray::FindEntryIndex(int32 SlotIndex) const
+{
+    if (SlotIndex < 0)
+    {
+        return INDEX_NONE;
+    }
+
+    // Entries are created in slot order and never reordered on the server
+    if (Entries.IsValidIndex(SlotIndex) && Entries[SlotIndex].SlotIndex == SlotIndex)
+    {
+        return SlotIndex;
+    }
+
+    // Clients may still be receiving the initial bunch; fall back to a search
+    return Entries.IndexOfByPredicate([SlotIndex](const FItemSlotEntry& Entry)
+    {
+        return Entry.SlotIndex == SlotIndex;
+    });
+}
+
+const FItemStructure& FItemSlotArray::operator[](int32 SlotIndex) const
+{
+    const int32 EntryIndex = FindEntryIndex(SlotIndex);
+    check(EntryIndex != INDEX_NONE);
+    return Entries[EntryIndex].Item;
+}
+
+void FItemSlotArray::SetSlot(int32 SlotIndex, const FItemStructure& Item)
+{
+    const int32 EntryIndex = FindEntryIndex(SlotIndex);
+    if (EntryIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    FItemSlotEntry& Entry = Entries[EntryIndex];
+    Entry.Item = Item;
+    MarkItemDirty(Entry);
+}
+
+void FItemSlotArray::NotifySlotReplicated(int32 SlotIndex) const
+{
+    if (Owner)
+    {
+        Owner->HandleSlotReplicated(SlotIndex);
+    }
+}
@@ -0,0 +1,140 @@
+// ItemSlotStore.cpp
+
+#include "Components/Inventory/ItemSlotStore.h"
+
+#include "Core/SurvivalAssetManager.h"
+
+namespace ItemSlotStore
+{
+    static int32 ResolveDefinitionId(const FName RegistryKey)
+    {
+        if (RegistryKey.IsNone())
+        {
+            return INDEX_NONE;
+        }
+
+        const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+        return AssetManager ? AssetManager->GetItemNetIndex(RegistryKey) : INDEX_NONE;
+    }
+}
+
+void FItemSlotStore::Init(const int32 NumSlots)
+{
+    if (NumSlots <= 0)
+    {
+        DefinitionIds.Empty();
+        Quantities.Empty();
+        StackSizes.Empty();
+        ColdData.Empty();
+        return;
+    }
+
+    DefinitionIds.Reset();
+    Quantities.Reset();
+    StackSizes.Reset();
+    ColdData.Reset();
+
+    Reserve(NumSlots);
+}
+
+void FItemSlotStore::Reserve(const int32 NumSlots)
+{
+    const int32 NumToAdd = NumSlots - Num();
+    if (NumToAdd <= 0)
+    {
+        return;
+    }
+
+    // Match the values of an empty FItemStructure so MakeItem round-trips
+    const FItemStructure Empty;
+    for (int32 Index = 0; Index < NumToAdd; ++Index)
+    {
+        DefinitionIds.Add(INDEX_NONE);
+        Quantities.Add(Empty.ItemQuantity);
+        StackSizes.Add(Empty.StackSize);
+
+        FItemSlotColdData& Cold = ColdData.AddDefaulted_GetRef();
+        Cold.CurrentHP = Empty.CurrentHP;
+        Cold.MaxHP = Empty.MaxHP;
+        Cold.CurrentAmmo = Empty.CurrentAmmo;
+        Cold.MaxAmmo = Empty.MaxAmmo;
+    }
+}
+
+void FItemSlotStore::Set(const int32 SlotIndex, const FItemStructure& Item)
+{
+    if (!IsValidIndex(SlotIndex))
+    {
+        return;
+    }
+
+    // Only resolve the id when the item actually changes
+    if (ColdData[SlotIndex].RegistryKey != Item.RegistryKey || DefinitionIds[SlotIndex] == INDEX_NONE)
+    {
+        DefinitionIds[SlotIndex] = ItemSlotStore::ResolveDefinitionId(Item.RegistryKey);
+    }
+
+    Quantities[SlotIndex] = Item.ItemQuantity;
+    StackSizes[SlotIndex] = Item.StackSize;
+
+    FItemSlotColdData& Cold = ColdData[SlotIndex];
+    Cold.RegistryKey = Item.RegistryKey;
+    Cold.ItemAsset = Item.ItemAsset;
+    Cold.CurrentHP = Item.CurrentHP;
+    Cold.MaxHP = Item.MaxHP;
+    Cold.CurrentAmmo = Item.CurrentAmmo;
+    Cold.MaxAmmo = Item.MaxAmmo;
+}
+
+FItemStructure FItemSlotStore::MakeItem(const int32 SlotIndex) const
+{
+    FItemStructure Item;
+    if (!IsValidIndex(SlotIndex))
+    {
+        return Item;
+    }
+
+    const FItemSlotColdData& Cold = ColdData[SlotIndex];
+    Item.RegistryKey = Cold.RegistryKey;
+    Item.ItemAsset = Cold.ItemAsset;
+    Item.ItemQuantity = Quantities[SlotIndex];
+    Item.StackSize = StackSizes[SlotIndex];
+    Item.CurrentHP = Cold.CurrentHP;
+    Item.MaxHP = Cold.MaxHP;
+    Item.CurrentAmmo = Cold.CurrentAmmo;
+    Item.MaxAmmo = Cold.MaxAmmo;
+    return Item;
+}
+
+int32 FItemSlotStore::CountOf(const FName RegistryKey) const
+{
+    if (RegistryKey.IsNone())
+    {
+        return 0;
+    }
+
+    int32 Total = 0;
+
+    const int32 DefinitionId = ItemSlotStore::ResolveDefinitionId(RegistryKey);
+    if (DefinitionId != INDEX_NONE)
+    {
+        for (int32 SlotIndex = 0; SlotIndex < DefinitionIds.Num(); ++SlotIndex)
+        {
+            if (DefinitionIds[SlotIndex] == DefinitionId)
+            {
+                Total += Quantities[SlotIndex];
+            }
+        }
+        return Total;
+    }
+
+    // Items outside the index have no id, fall back to comparing keys
+    for (int32 SlotIndex = 0; SlotIndex < ColdData.Num(); ++SlotIndex)
+    {
+        if (ColdData[SlotIndex].RegistryKey == RegistryKey)
+        {
+            Total += Quantities[SlotIndex];
+        }
+    }
+    return Total;
+}
@@ -0,0 +1,74 @@
+// SlotMoveCommand.cpp
+
+#include "Components/Inventory/SlotMoveCommand.h"
+
+namespace SlotMoveCommandNet
+{
+    constexpr uint32 ContainerTypeBits = 4;
+    constexpr uint8 ContainerTypeMask = (1 << ContainerTypeBits) - 1;
+
+    static_assert(static_cast<uint8>(E_ContainerType::Hidden) <= ContainerTypeMask, "E_ContainerType no longer fits in ContainerTypeBits");
+
+    /** Zigzag encoding: small magnitudes of either sign stay small, and INDEX_NONE survives the trip */
+    static uint32 ToPacked(const int32 Value)
+    {
+        return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+    }
+
+    static int32 FromPacked(const uint32 Packed)
+    {
+        return static_cast<int32>(Packed >> 1) ^ -static_cast<int32>(Packed & 1);
+    }
+}
+
+bool FSlotMoveCommand::IsWellFormed() const
+{
+    return FromContainer != E_ContainerType::None && ToContainer != E_ContainerType::None
+        && FromIndex >= 0 && ToIndex >= 0 && Quantity >= 0 && PredictionKey >= 0;
+}
+
+bool FSlotMoveCommand::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    using namespace SlotMoveCommandNet;
+
+    uint8 Containers = 0;
+    if (Ar.IsSaving())
+    {
+        Containers = (static_cast<uint8>(FromContainer) & ContainerTypeMask)
+            | ((static_cast<uint8>(ToContainer) & ContainerTypeMask) << ContainerTypeBits);
+    }
+    Ar << Containers;
+
+    uint32 PackedFromIndex = ToPacked(FromIndex);
+    uint32 PackedToIndex = ToPacked(ToIndex);
+    uint32 PackedQuantity = ToPacked(Quantity);
+    uint32 PackedKey = ToPacked(PredictionKey);
+    Ar.SerializeIntPacked(PackedFromIndex);
+    Ar.SerializeIntPacked(PackedToIndex);
+    Ar.SerializeIntPacked(PackedQuantity);
+    Ar.SerializeIntPacked(PackedKey);
+
+    if (Ar.IsLoading())
+    {
+        const uint8 From = Containers & ContainerTypeMask;
+        const uint8 To = Containers >> ContainerTypeBits;
+        const uint8 MaxType = static_cast<uint8>(E_ContainerType::Hidden);
+
+        if (From > MaxType || To > MaxType)
+        {
+            bOutSuccess = false;
+            return false;
+        }
+
+        // Decoded as sent; negative values are rejected by IsWellFormed on the server, not rewritten here
+        FromContainer = static_cast<E_ContainerType>(From);
+        ToContainer = static_cast<E_ContainerType>(To);
+        FromIndex = FromPacked(PackedFromIndex);
+        ToIndex = FromPacked(PackedToIndex);
+        Quantity = FromPacked(PackedQuantity);
+        PredictionKey = FromPacked(PackedKey);
+    }
+
+    bOutSuccess = !Ar.IsError();
+    return bOutSuccess;
+}
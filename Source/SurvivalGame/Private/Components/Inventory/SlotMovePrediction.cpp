@@ -0,0 +1,209 @@
+// SlotMovePrediction.cpp
+
+#include "Components/Inventory/SlotMovePrediction.h"
+
+int32 FSlotMovePrediction::PredictMove(const FSlotMoveCommand& Command,
+                                       const TFunctionRef<FItemStructure(E_ContainerType, int32)> ReadConfirmed,
+                                       TArray<FDisplayChange>& OutChanges)
+{
+    const uint64 FromSlot = MakeSlotId(Command.FromContainer, Command.FromIndex);
+    const uint64 ToSlot = MakeSlotId(Command.ToContainer, Command.ToIndex);
+    if (FromSlot == ToSlot)
+    {
+        return 0;
+    }
+
+    // Moves queued behind an unanswered one start from its predicted result
+    auto ReadPredicted = [this, &ReadConfirmed](const uint64 SlotId, const E_ContainerType ContainerType, const int32 SlotIndex)
+    {
+        const FPredictedSlot* Slot = Slots.Find(SlotId);
+        return Slot ? Slot->Predicted : ReadConfirmed(ContainerType, SlotIndex);
+    };
+
+    FItemStructure Source = ReadPredicted(FromSlot, Command.FromContainer, Command.FromIndex);
+    FItemStructure Destination = ReadPredicted(ToSlot, Command.ToContainer, Command.ToIndex);
+    if (!SimulateMove(Source, Destination, Command.Quantity))
+    {
+        return 0;
+    }
+
+    const int32 Key = NextKey;
+    NextKey = NextKey == MAX_int32 ? 1 : NextKey + 1;
+
+    auto WritePredicted = [this, Key, &ReadConfirmed, &OutChanges](const uint64 SlotId, const E_ContainerType ContainerType, const int32 SlotIndex, const FItemStructure& Item)
+    {
+        FPredictedSlot* Slot = Slots.Find(SlotId);
+        if (!Slot)
+        {
+            Slot = &Slots.Add(SlotId);
+            Slot->Confirmed = ReadConfirmed(ContainerType, SlotIndex);
+        }
+
+        Slot->Predicted = Item;
+        Slot->LatestKey = Key;
+        AddChange(SlotId, Item, OutChanges);
+    };
+
+    WritePredicted(FromSlot, Command.FromContainer, Command.FromIndex, Source);
+    WritePredicted(ToSlot, Command.ToContainer, Command.ToIndex, Destination);
+
+    FPendingMove& Move = PendingMoves.AddDefaulted_GetRef();
+    Move.Key = Key;
+    Move.FromSlot = FromSlot;
+    Move.ToSlot = ToSlot;
+
+    return Key;
+}
+
+bool FSlotMovePrediction::ConfirmSlot(const E_ContainerType ContainerType, const int32 SlotIndex, const FItemStructure& Item)
+{
+    FPredictedSlot* Slot = Slots.Find(MakeSlotId(ContainerType, SlotIndex));
+    if (!Slot)
+    {
+        return false;
+    }
+
+    Slot->Confirmed = Item;
+    return true;
+}
+
+void FSlotMovePrediction::Reconcile(const int32 LastProcessedKey, const TConstArrayView<int32> RejectedKeys,
+                                    const TFunctionRef<bool(E_ContainerType, int32, FItemStructure&)> ReadReplicated,
+                                    TArray<FDisplayChange>& OutChanges)
+{
+    const bool bRejected = PendingMoves.ContainsByPredicate([RejectedKeys](const FPendingMove& Move)
+    {
+        return RejectedKeys.Contains(Move.Key);
+    });
+
+    if (bRejected)
+    {
+        for (const TPair<uint64, FPredictedSlot>& Slot : Slots)
+        {
+            AddConfirmedChange(Slot.Key, Slot.Value, ReadReplicated, OutChanges);
+        }
+
+        // Acks for the dropped moves that arrive later match nothing and are ignored
+        Slots.Reset();
+        PendingMoves.Reset();
+        return;
+    }
+
+    int32 NumRetired = 0;
+    while (NumRetired < PendingMoves.Num() && PendingMoves[NumRetired].Key <= LastProcessedKey)
+    {
+        const FPendingMove& Move = PendingMoves[NumRetired++];
+        RetireSlot(Move.FromSlot, Move.Key, ReadReplicated, OutChanges);
+        RetireSlot(Move.ToSlot, Move.Key, ReadReplicated, OutChanges);
+    }
+
+    PendingMoves.RemoveAt(0, NumRetired, EAllowShrinking::No);
+}
+
+void FSlotMovePrediction::RetireSlot(const uint64 SlotId, const int32 Key,
+                                     const TFunctionRef<bool(E_ContainerType, int32, FItemStructure&)> ReadReplicated,
+                                     TArray<FDisplayChange>& OutChanges)
+{
+    const FPredictedSlot* Slot = Slots.Find(SlotId);
+    if (!Slot || Slot->LatestKey != Key)
+    {
+        return;
+    }
+
+    AddConfirmedChange(SlotId, *Slot, ReadReplicated, OutChanges);
+    Slots.Remove(SlotId);
+}
+
+void FSlotMovePrediction::AddConfirmedChange(const uint64 SlotId, const FPredictedSlot& Slot,
+                                             const TFunctionRef<bool(E_ContainerType, int32, FItemStructure&)> ReadReplicated,
+                                             TArray<FDisplayChange>& OutChanges)
+{
+    const int32 ChangeIndex = OutChanges.Num();
+    AddChange(SlotId, Slot.Confirmed, OutChanges);
+
+    // Confirmed was only read at predict time for containers without slot updates
+    FDisplayChange& Change = OutChanges[ChangeIndex];
+    FItemStructure Replicated;
+    if (ReadReplicated(Change.ContainerType, Change.SlotIndex, Replicated))
+    {
+        Change.Item = MoveTemp(Replicated);
+    }
+}
+
+void FSlotMovePrediction::Reset()
+{
+    Slots.Reset();
+    PendingMoves.Reset();
+}
+
+bool FSlotMovePrediction::SimulateMove(FItemStructure& Source, FItemStructure& Destination, const int32 Quantity)
+{
+    if (Source.IsEmpty() || Quantity > Source.ItemQuantity)
+    {
+        return false;
+    }
+
+    const FItemStructure EmptyItem;
+
+    // Whole stack
+    if (Quantity <= 0 || Quantity == Source.ItemQuantity)
+    {
+        if (Destination.IsEmpty())
+        {
+            Destination = Source;
+            Source = EmptyItem;
+        }
+        else if (Source.RegistryKey == Destination.RegistryKey && Destination.StackSize > 1)
+        {
+            const int32 AmountToMove = FMath::Min(Source.ItemQuantity, Destination.StackSize - Destination.ItemQuantity);
+            if (AmountToMove <= 0)
+            {
+                Swap(Source, Destination);
+                return true;
+            }
+
+            Destination.ItemQuantity += AmountToMove;
+            Source.ItemQuantity -= AmountToMove;
+            if (Source.ItemQuantity <= 0)
+            {
+                Source = EmptyItem;
+            }
+        }
+        else
+        {
+            Swap(Source, Destination);
+        }
+        return true;
+    }
+
+    // Part of a stack
+    if (Destination.IsEmpty())
+    {
+        Destination = Source;
+        Destination.ItemQuantity = Quantity;
+    }
+    else if (Source.RegistryKey == Destination.RegistryKey && Destination.ItemQuantity + Quantity <= Destination.StackSize)
+    {
+        Destination.ItemQuantity += Quantity;
+    }
+    else
+    {
+        return false;
+    }
+
+    Source.ItemQuantity -= Quantity;
+    return true;
+}
+
+uint64 FSlotMovePrediction::MakeSlotId(const E_ContainerType ContainerType, const int32 SlotIndex)
+{
+    return (static_cast<uint64>(ContainerType) << 32) | static_cast<uint32>(SlotIndex);
+}
+
+void FSlotMovePrediction::AddChange(const uint64 SlotId, const FItemStructure& Item, TArray<FDisplayChange>& OutChanges)
+{
+    FDisplayChange& Change = OutChanges.AddDefaulted_GetRef();
+    Change.ContainerType = static_cast<E_ContainerType>(SlotId >> 32);
+    Change.SlotIndex = static_cast<int32>(SlotId & MAX_uint32);
+    Change.Item = Item;
+}
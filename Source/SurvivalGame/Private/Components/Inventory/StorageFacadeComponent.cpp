@@ -0,0 +1,102 @@
+// StorageFacadeComponent.cpp
+
+#include "Components/Inventory/StorageFacadeComponent.h"
+
+#include "Components/Inventory/ItemContainerBase.h"
+#include "Core/SurvivalLog.h"
+#include "Engine/World.h"
+
+UStorageFacadeComponent::UStorageFacadeComponent()
+{
+    // All state lives in the arena; the facade never ticks or replicates
+    PrimaryComponentTick.bCanEverTick = false;
+    SetIsReplicatedByDefault(false);
+
+    MaxSlots = 20;
+}
+
+void UStorageFacadeComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    if (UStorageArenaSubsystem* Arena = GetArena())
+    {
+        Handle = Arena->AllocateContainer(MaxSlots);
+    }
+}
+
+void UStorageFacadeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UStorageArenaSubsystem* Arena = GetArena())
+    {
+        Arena->ReleaseContainer(Handle);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+int32 UStorageFacadeComponent::AddItem(const FItemStructure& Item)
+{
+    UStorageArenaSubsystem* Arena = GetArena();
+    return Arena ? Arena->AddItem(Handle, Item) : Item.ItemQuantity;
+}
+
+bool UStorageFacadeComponent::SetItemAtIndex(const int32 SlotIndex, const FItemStructure& Item)
+{
+    UStorageArenaSubsystem* Arena = GetArena();
+    return Arena && Arena->SetItem(Handle, SlotIndex, Item);
+}
+
+FItemStructure UStorageFacadeComponent::GetItemAtIndex(const int32 SlotIndex) const
+{
+    const UStorageArenaSubsystem* Arena = GetArena();
+    return Arena ? Arena->GetItem(Handle, SlotIndex) : FItemStructure();
+}
+
+int32 UStorageFacadeComponent::CountItem(const FName RegistryKey) const
+{
+    const UStorageArenaSubsystem* Arena = GetArena();
+    return Arena ? Arena->CountOf(Handle, RegistryKey) : 0;
+}
+
+bool UStorageFacadeComponent::OpenInto(UItemContainerBase* Viewer)
+{
+    const UStorageArenaSubsystem* Arena = GetArena();
+    if (!Arena || !IsValid(Viewer))
+    {
+        return false;
+    }
+
+    TArray<uint8> Bytes;
+    return Arena->WriteSnapshot(Handle, Bytes) && Viewer->LoadSnapshot(Bytes);
+}
+
+bool UStorageFacadeComponent::StoreFrom(UItemContainerBase* Viewer)
+{
+    UStorageArenaSubsystem* Arena = GetArena();
+    if (!Arena || !IsValid(Viewer))
+    {
+        return false;
+    }
+
+    TArray<uint8> Bytes;
+    Viewer->SaveSnapshot(Bytes);
+
+    if (!Arena->ReadSnapshot(Handle, Bytes))
+    {
+        UE_LOG(LogInventory, Warning, TEXT("StorageFacade: %s does not fit in %s"), *Viewer->GetName(), *GetName());
+        return false;
+    }
+    return true;
+}
+
+UStorageArenaSubsystem* UStorageFacadeComponent::GetArena() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UStorageArenaSubsystem>() : nullptr;
+}
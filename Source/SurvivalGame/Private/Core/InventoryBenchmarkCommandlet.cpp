@@ -0,0 +1,490 @@
+// InventoryBenchmarkCommandlet.cpp
+
+#include "Core/InventoryBenchmarkCommandlet.h"
+
+#include "Components/Inventory/Child/PlayerInventory.h"
+#include "Components/Inventory/ItemContainerSnapshot.h"
+#include "Components/Inventory/ItemSlotStore.h"
+#include "Core/SurvivalAssetManager.h"
+#include "Core/SurvivalLog.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PrimaryData/ItemInfo.h"
+
+namespace InventoryBenchmark
+{
+    /**
+     * Forwards to the engine allocator and counts game thread allocations while enabled.
+     * Installed as GMalloc for the duration of the run only.
+     */
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+        explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+        bool bCounting = false;
+        int64 NumAllocs = 0;
+        int64 NumBytes = 0;
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+        {
+            Record(Count);
+            return Inner->Malloc(Count, Alignment);
+        }
+
+        virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+        {
+            Record(Count);
+            return Inner->TryMalloc(Count, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            Record(Count);
+            return Inner->Realloc(Original, Count, Alignment);
+        }
+
+        virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            Record(Count);
+            return Inner->TryRealloc(Original, Count, Alignment);
+        }
+
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+        virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual const TCHAR* GetDescriptiveName() override { return TEXT("InventoryBenchmarkCounting"); }
+
+        FMalloc* GetInner() const { return Inner; }
+
+    private:
+        void Record(const SIZE_T Count)
+        {
+            // Background threads (asset registry, logging) would only add noise
+            if (bCounting && IsInGameThread())
+            {
+                ++NumAllocs;
+                NumBytes += Count;
+            }
+        }
+
+        FMalloc* Inner;
+    };
+
+    /** Snapshot of a NumSlots container with ItemAt(SlotIndex) in every slot */
+    static TArray<uint8> MakeFixture(const int32 NumSlots, const TFunctionRef<FItemStructure(int32 SlotIndex)> ItemAt)
+    {
+        FItemSlotStore Store;
+        Store.Init(NumSlots);
+        for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+        {
+            Store.Set(SlotIndex, ItemAt(SlotIndex));
+        }
+
+        TArray<uint8> Bytes;
+        FItemContainerSnapshot::Write(Store, 0, NumSlots, Bytes);
+        return Bytes;
+    }
+
+    static FItemStructure MakeItem(const FItemIndexEntry& Entry, const int32 Quantity)
+    {
+        FItemStructure Item;
+        Item.RegistryKey = Entry.RegistryKey;
+        Item.ItemAsset = TSoftObjectPtr<UItemInfo>(Entry.AssetPath);
+        Item.StackSize = FMath::Max(Entry.StackSize, 1);
+        Item.ItemQuantity = FMath::Clamp(Quantity, 1, Item.StackSize);
+        return Item;
+    }
+
+    static FString MakeResultKey(const FString& Case, const int32 NumSlots)
+    {
+        return FString::Printf(TEXT("%s@%d"), *Case, NumSlots);
+    }
+}
+
+UInventoryBenchmarkCommandlet::UInventoryBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UInventoryBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace InventoryBenchmark;
+
+    FString SizesParam = TEXT("16,64,256,1024");
+    FParse::Value(*Params, TEXT("Sizes="), SizesParam);
+
+    int32 Iterations = 50;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    Iterations = FMath::Max(Iterations, 1);
+
+    double Margin = 0.15;
+    FParse::Value(*Params, TEXT("Margin="), Margin);
+
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("Inventory-%s.csv"), *FDateTime::Now().ToString());
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    FString BaselinePath = FPaths::ProjectDir() / TEXT("Build/Benchmarks/InventoryBaseline.csv");
+    FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+
+    const bool bUpdateBaseline = FParse::Param(*Params, TEXT("UpdateBaseline"));
+
+    TArray<int32> Sizes;
+    {
+        TArray<FString> SizeStrings;
+        SizesParam.ParseIntoArray(SizeStrings, TEXT(","));
+        for (const FString& SizeString : SizeStrings)
+        {
+            const int32 Size = FCString::Atoi(*SizeString);
+            if (Size >= 2)
+            {
+                Sizes.Add(Size);
+            }
+        }
+    }
+
+    // Fixture items come from the item index, so the run uses real definitions without loading them
+    const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+    const TArray<FItemIndexEntry>* ItemIndex = AssetManager ? &AssetManager->GetItemIndex() : nullptr;
+    if (!ItemIndex || ItemIndex->Num() < 2)
+    {
+        UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: Needs at least two indexed items, found %d"), ItemIndex ? ItemIndex->Num() : 0);
+        return 1;
+    }
+
+    const FItemIndexEntry* StackableEntry = ItemIndex->FindByPredicate([](const FItemIndexEntry& Entry) { return Entry.StackSize > 1; });
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("InventoryBenchmark"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+
+    FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+    GMalloc = CountingMalloc;
+
+    TArray<FBenchmarkResult> Results;
+
+    for (const int32 NumSlots : Sizes)
+    {
+        AActor* Owner = World->SpawnActor<AActor>();
+        UPlayerInventory* Inventory = NewObject<UPlayerInventory>(Owner);
+        Inventory->MaxSlots = NumSlots;
+        Inventory->bViewerScopedReplication = false;
+        Inventory->RegisterComponent();
+        Inventory->OnSlotChanged.AddDynamic(this, &UInventoryBenchmarkCommandlet::HandleSlotChanged);
+
+        // Consecutive slots get different definitions, so nothing merges unless a case wants it
+        auto ItemFor = [ItemIndex](const int32 Seed)
+        {
+            return MakeItem((*ItemIndex)[Seed % ItemIndex->Num()], 1);
+        };
+
+        const FItemStructure EmptyItem;
+        const TArray<uint8> EmptyFixture = MakeFixture(NumSlots, [&EmptyItem](int32) { return EmptyItem; });
+        const TArray<uint8> FullFixture = MakeFixture(NumSlots, [&ItemFor](const int32 SlotIndex) { return ItemFor(SlotIndex); });
+        const TArray<uint8> HalfFixture = MakeFixture(NumSlots, [&ItemFor, &EmptyItem, NumSlots](const int32 SlotIndex)
+        {
+            return SlotIndex < NumSlots / 2 ? ItemFor(SlotIndex) : EmptyItem;
+        });
+        const TArray<uint8> AllButLastFixture = MakeFixture(NumSlots, [&ItemFor, &EmptyItem, NumSlots](const int32 SlotIndex)
+        {
+            return SlotIndex < NumSlots - 1 ? ItemFor(SlotIndex) : EmptyItem;
+        });
+
+        /** Restores Fixture, then times RunOps (which returns its op count) with allocation counting on */
+        auto Measure = [&](const TCHAR* Case, const TArray<uint8>& Fixture, TFunctionRef<int32()> RunOps)
+        {
+            FBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+            Result.Case = Case;
+            Result.NumSlots = NumSlots;
+
+            double BestNsPerOp = TNumericLimits<double>::Max();
+            int64 TotalOps = 0;
+            int64 TotalAllocs = 0;
+            int64 TotalBytes = 0;
+            int64 TotalSlotWrites = 0;
+
+            // One untimed pass warms caches and any lazily built indices
+            for (int32 Iteration = -1; Iteration < Iterations; ++Iteration)
+            {
+                if (!Fixture.IsEmpty())
+                {
+                    Inventory->LoadSnapshot(Fixture);
+                }
+
+                CountingMalloc->NumAllocs = 0;
+                CountingMalloc->NumBytes = 0;
+                SlotWrites = 0;
+                CountingMalloc->bCounting = true;
+
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                const int32 NumOps = RunOps();
+                const uint64 EndCycles = FPlatformTime::Cycles64();
+
+                CountingMalloc->bCounting = false;
+
+                if (Iteration < 0 || NumOps <= 0)
+                {
+                    continue;
+                }
+
+                const double Nanoseconds = FPlatformTime::ToSeconds64(EndCycles - StartCycles) * 1.0e9;
+                BestNsPerOp = FMath::Min(BestNsPerOp, Nanoseconds / NumOps);
+                TotalOps += NumOps;
+                TotalAllocs += CountingMalloc->NumAllocs;
+                TotalBytes += CountingMalloc->NumBytes;
+                TotalSlotWrites += SlotWrites;
+            }
+
+            if (TotalOps > 0)
+            {
+                Result.NsPerOp = BestNsPerOp;
+                Result.AllocsPerOp = static_cast<double>(TotalAllocs) / TotalOps;
+                Result.AllocBytesPerOp = static_cast<double>(TotalBytes) / TotalOps;
+                Result.SlotWritesPerOp = static_cast<double>(TotalSlotWrites) / TotalOps;
+            }
+
+            UE_LOG(LogInventory, Display, TEXT("InventoryBenchmark: %-20s %5d slots  %10.1f ns/op  %6.2f allocs/op  %8.1f bytes/op  %5.2f slot writes/op"),
+                Case, NumSlots, Result.NsPerOp, Result.AllocsPerOp, Result.AllocBytesPerOp, Result.SlotWritesPerOp);
+        };
+
+        Measure(TEXT("AddItem"), EmptyFixture, [&]()
+        {
+            for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+            {
+                Inventory->AddItem(ItemFor(SlotIndex));
+            }
+            return NumSlots;
+        });
+
+        Measure(TEXT("TransferItem.Move"), HalfFixture, [&]()
+        {
+            const int32 Half = NumSlots / 2;
+            for (int32 SlotIndex = 0; SlotIndex < Half; ++SlotIndex)
+            {
+                Inventory->TransferItem(Inventory, SlotIndex + Half, SlotIndex);
+            }
+            return Half;
+        });
+
+        Measure(TEXT("TransferItem.Swap"), FullFixture, [&]()
+        {
+            const int32 Half = NumSlots / 2;
+            for (int32 SlotIndex = 0; SlotIndex < Half; ++SlotIndex)
+            {
+                Inventory->TransferItem(Inventory, NumSlots - 1 - SlotIndex, SlotIndex);
+            }
+            return Half;
+        });
+
+        if (StackableEntry)
+        {
+            // Pairs of half stacks; each op tops up the second from the first
+            const int32 HalfStack = FMath::Max(StackableEntry->StackSize / 2, 1);
+            const TArray<uint8> StackFixture = MakeFixture(NumSlots, [StackableEntry, HalfStack](int32)
+            {
+                return MakeItem(*StackableEntry, HalfStack);
+            });
+
+            Measure(TEXT("TransferItem.Stack"), StackFixture, [&]()
+            {
+                const int32 NumPairs = NumSlots / 2;
+                for (int32 Pair = 0; Pair < NumPairs; ++Pair)
+                {
+                    Inventory->TransferItem(Inventory, Pair * 2 + 1, Pair * 2);
+                }
+                return NumPairs;
+            });
+        }
+        else
+        {
+            UE_LOG(LogInventory, Warning, TEXT("InventoryBenchmark: No stackable item indexed, skipping TransferItem.Stack"));
+        }
+
+        Measure(TEXT("RemoveItemAtIndex"), FullFixture, [&]()
+        {
+            for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+            {
+                bool bRemoved = false;
+                Inventory->RemoveItemAtIndex(SlotIndex, bRemoved);
+            }
+            return NumSlots;
+        });
+
+        // Worst case: the only free slot is the last one
+        Measure(TEXT("FindEmptySlot"), AllButLastFixture, [&]()
+        {
+            for (int32 Query = 0; Query < NumSlots; ++Query)
+            {
+                bool bFound = false;
+                int32 EmptyIndex = INDEX_NONE;
+                Inventory->FindEmptySlot(bFound, EmptyIndex);
+            }
+            return NumSlots;
+        });
+
+        Measure(TEXT("SortContainer.Name"), FullFixture, [&]()
+        {
+            Inventory->SortContainer(E_SortMethod::Name);
+            return 1;
+        });
+
+        Owner->Destroy();
+    }
+
+    // The counter is left allocated: other threads may still hold the pointer it replaced.
+    // Everything it allocated belongs to the inner allocator.
+    GMalloc = CountingMalloc->GetInner();
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+
+    const FString Csv = ToCsv(Results);
+    if (!FFileHelper::SaveStringToFile(Csv, *OutputPath))
+    {
+        UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: Could not write %s"), *OutputPath);
+        return 1;
+    }
+    UE_LOG(LogInventory, Display, TEXT("InventoryBenchmark: Wrote %s"), *OutputPath);
+
+    if (bUpdateBaseline)
+    {
+        if (!FFileHelper::SaveStringToFile(Csv, *BaselinePath))
+        {
+            UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: Could not write baseline %s"), *BaselinePath);
+            return 1;
+        }
+        UE_LOG(LogInventory, Display, TEXT("InventoryBenchmark: Updated baseline %s"), *BaselinePath);
+        return 0;
+    }
+
+    // Without a usable baseline nothing was checked, which must not pass as a green run
+    FString BaselineText;
+    if (!FFileHelper::LoadFileToString(BaselineText, *BaselinePath))
+    {
+        UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: No baseline at %s, run with -UpdateBaseline to create one"), *BaselinePath);
+        return 1;
+    }
+
+    TArray<FBenchmarkResult> Baseline;
+    if (!ParseCsv(BaselineText, Baseline))
+    {
+        UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: Baseline %s is malformed or has no entries, run with -UpdateBaseline to record one"), *BaselinePath);
+        return 1;
+    }
+
+    const int32 NumRegressions = CompareToBaseline(Results, Baseline, Margin);
+    if (NumRegressions > 0)
+    {
+        UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: %d cases regressed by more than %.0f%% or have no baseline"), NumRegressions, Margin * 100.0);
+        return 1;
+    }
+
+    UE_LOG(LogInventory, Display, TEXT("InventoryBenchmark: All cases within %.0f%% of the baseline"), Margin * 100.0);
+    return 0;
+}
+
+void UInventoryBenchmarkCommandlet::HandleSlotChanged(int32 SlotIndex, const FItemStructure& Item)
+{
+    ++SlotWrites;
+}
+
+//===========================================Results====================================================
+FString UInventoryBenchmarkCommandlet::ToCsv(const TArray<FBenchmarkResult>& Results)
+{
+    FString Csv = TEXT("Case,Slots,NsPerOp,AllocsPerOp,AllocBytesPerOp,SlotWritesPerOp\n");
+    for (const FBenchmarkResult& Result : Results)
+    {
+        Csv += FString::Printf(TEXT("%s,%d,%.2f,%.3f,%.1f,%.3f\n"),
+            *Result.Case, Result.NumSlots, Result.NsPerOp, Result.AllocsPerOp, Result.AllocBytesPerOp, Result.SlotWritesPerOp);
+    }
+    return Csv;
+}
+
+bool UInventoryBenchmarkCommandlet::ParseCsv(const FString& Text, TArray<FBenchmarkResult>& OutResults)
+{
+    TArray<FString> Lines;
+    Text.ParseIntoArrayLines(Lines);
+
+    // The header has to match what ToCsv writes, so a reordered file is not read column-shifted
+    if (Lines.IsEmpty() || Lines[0].TrimEnd() != ToCsv({}).TrimEnd())
+    {
+        return false;
+    }
+
+    for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+    {
+        TArray<FString> Fields;
+        Lines[LineIndex].ParseIntoArray(Fields, TEXT(","), false);
+
+        FBenchmarkResult Result;
+        const bool bParsed = Fields.Num() == 6 && !Fields[0].IsEmpty()
+            && LexTryParseString(Result.NumSlots, *Fields[1])
+            && LexTryParseString(Result.NsPerOp, *Fields[2])
+            && LexTryParseString(Result.AllocsPerOp, *Fields[3])
+            && LexTryParseString(Result.AllocBytesPerOp, *Fields[4])
+            && LexTryParseString(Result.SlotWritesPerOp, *Fields[5]);
+        if (!bParsed)
+        {
+            UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: Baseline line %d is malformed: %s"), LineIndex + 1, *Lines[LineIndex]);
+            return false;
+        }
+
+        Result.Case = Fields[0];
+        OutResults.Add(MoveTemp(Result));
+    }
+
+    return !OutResults.IsEmpty();
+}
+
+int32 UInventoryBenchmarkCommandlet::CompareToBaseline(const TArray<FBenchmarkResult>& Results, const TArray<FBenchmarkResult>& Baseline, const double Margin)
+{
+    using namespace InventoryBenchmark;
+
+    TMap<FString, const FBenchmarkResult*> BaselineByKey;
+    for (const FBenchmarkResult& Entry : Baseline)
+    {
+        BaselineByKey.Add(MakeResultKey(Entry.Case, Entry.NumSlots), &Entry);
+    }
+
+    // Allocation counts are averages, so allow a little slack before calling them a regression
+    constexpr double AllocSlack = 0.05;
+
+    int32 NumRegressions = 0;
+    for (const FBenchmarkResult& Result : Results)
+    {
+        const FBenchmarkResult* const* Found = BaselineByKey.Find(MakeResultKey(Result.Case, Result.NumSlots));
+        // An unrecorded case is unchecked; count it so new cases get a baseline when they land
+        if (!Found)
+        {
+            ++NumRegressions;
+            UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: %s@%d has no baseline entry, rerun with -UpdateBaseline"), *Result.Case, Result.NumSlots);
+            continue;
+        }
+
+        const FBenchmarkResult& Base = **Found;
+        const bool bSlower = Result.NsPerOp > Base.NsPerOp * (1.0 + Margin);
+        const bool bMoreAllocs = Result.AllocsPerOp > Base.AllocsPerOp * (1.0 + Margin) + AllocSlack;
+
+        if (bSlower || bMoreAllocs)
+        {
+            ++NumRegressions;
+            UE_LOG(LogInventory, Error, TEXT("InventoryBenchmark: %s@%d regressed: %.1f ns/op (baseline %.1f), %.2f allocs/op (baseline %.2f)"),
+                *Result.Case, Result.NumSlots, Result.NsPerOp, Base.NsPerOp, Result.AllocsPerOp, Base.AllocsPerOp);
+        }
+    }
+
+    return NumRegressions;
+}
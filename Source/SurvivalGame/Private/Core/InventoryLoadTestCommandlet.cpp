@@ -0,0 +1,623 @@
+// InventoryLoadTestCommandlet.cpp
+
+#include "Core/InventoryLoadTestCommandlet.h"
+
+#include "Characters/Childs/GamePlayerCharacter.h"
+#include "Components/Inventory/Child/StorageContainer.h"
+#include "Components/Inventory/SlotMoveCommand.h"
+#include "Core/LoadTestNetDriver.h"
+#include "Core/StorageSubsystem.h"
+#include "Core/SurvivalAssetManager.h"
+#include "Core/SurvivalLog.h"
+#include "Core/SurvivalPlayerController.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PrimaryData/ItemInfo.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+
+//===========================================ALoadTestStorageActor====================================================
+ALoadTestStorageActor::ALoadTestStorageActor()
+{
+    PrimaryActorTick.bCanEverTick = false;
+    bReplicates = true;
+    bReplicateUsingRegisteredSubObjectList = true;
+
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+    Storage = CreateDefaultSubobject<UStorageContainer>(TEXT("Storage"));
+    Storage->MaxSlots = 30;
+    Storage->SetIsReplicated(true);
+}
+
+//===========================================FInventoryLoadTestAccess====================================================
+/** The non-public pieces the load test needs; befriended by the classes it reaches into */
+struct FInventoryLoadTestAccess
+{
+    static UFunction* GetSubmitMoveCommands(const AGamePlayerCharacter& Character)
+    {
+        return Character.FindFunctionChecked(GET_FUNCTION_NAME_CHECKED(AGamePlayerCharacter, Server_SubmitMoveCommands));
+    }
+
+    static int32 GetMaxMoveCommandsPerBatch(const AGamePlayerCharacter& Character)
+    {
+        return Character.MaxMoveCommandsPerBatch;
+    }
+
+    static FString GetStoragePath(const FGuid& StorageId)
+    {
+        return UStorageSubsystem::GetStoragePath(StorageId);
+    }
+};
+
+//===========================================Scenario====================================================
+namespace InventoryLoadTest
+{
+    struct FSettings
+    {
+        int32 Seconds = 30;
+        int32 WarmupSeconds = 2;
+        float TickRate = 30.0f;
+        float ActionsPerSecond = 2.0f;
+        int32 BotsPerChest = 4;
+        TSubclassOf<AGamePlayerCharacter> PawnClass;
+    };
+
+    struct FBot
+    {
+        TWeakObjectPtr<ASurvivalPlayerController> Controller;
+        TWeakObjectPtr<AGamePlayerCharacter> Character;
+        TWeakObjectPtr<UStorageContainer> Chest;
+        ULoadTestNetConnection* Connection = nullptr;
+        bool bChestOpen = false;
+
+        /** Moves queued this frame; a real client sends them as one Server_SubmitMoveCommands */
+        TArray<FSlotMoveCommand> FrameMoves;
+
+        int64 RPCsReceived = 0;
+        int64 MoveBytesReceived = 0;
+    };
+
+    struct FScenarioResult
+    {
+        int32 NumClients = 0;
+        double TickP50Ms = 0.0;
+        double TickP90Ms = 0.0;
+        double TickP99Ms = 0.0;
+        double TickMaxMs = 0.0;
+        double PostActorTickMs = 0.0;
+        double BytesSentPerClientSec = 0.0;
+        double PacketsSentPerClientSec = 0.0;
+        double RPCsSentPerClientSec = 0.0;
+        double RPCsReceivedPerClientSec = 0.0;
+        double MoveBytesReceivedPerClientSec = 0.0;
+    };
+
+    /** Points the game net driver definition at ULoadTestNetDriver for the lifetime of the scope */
+    class FScopedLoadTestNetDriver
+    {
+    public:
+        FScopedLoadTestNetDriver()
+        {
+            const FName DriverClassName(*ULoadTestNetDriver::StaticClass()->GetPathName());
+
+            for (int32 Index = 0; Index < GEngine->NetDriverDefinitions.Num(); ++Index)
+            {
+                FNetDriverDefinition& Definition = GEngine->NetDriverDefinitions[Index];
+                if (Definition.DefName == NAME_GameNetDriver)
+                {
+                    SavedIndex = Index;
+                    Saved = Definition;
+                    Definition.DriverClassName = DriverClassName;
+                    Definition.DriverClassNameFallback = DriverClassName;
+                    return;
+                }
+            }
+
+            FNetDriverDefinition& Definition = GEngine->NetDriverDefinitions.AddDefaulted_GetRef();
+            Definition.DefName = NAME_GameNetDriver;
+            Definition.DriverClassName = DriverClassName;
+            Definition.DriverClassNameFallback = DriverClassName;
+        }
+
+        ~FScopedLoadTestNetDriver()
+        {
+            if (SavedIndex != INDEX_NONE)
+            {
+                GEngine->NetDriverDefinitions[SavedIndex] = Saved;
+            }
+            else
+            {
+                GEngine->NetDriverDefinitions.Pop();
+            }
+        }
+
+    private:
+        int32 SavedIndex = INDEX_NONE;
+        FNetDriverDefinition Saved;
+    };
+
+    static FItemStructure MakeItem(const FItemIndexEntry& Entry, const int32 Quantity)
+    {
+        FItemStructure Item;
+        Item.RegistryKey = Entry.RegistryKey;
+        Item.ItemAsset = TSoftObjectPtr<UItemInfo>(Entry.AssetPath);
+        Item.StackSize = FMath::Max(Entry.StackSize, 1);
+        Item.ItemQuantity = FMath::Clamp(Quantity, 1, Item.StackSize);
+        return Item;
+    }
+
+    static FItemStructure RandomItem(const TArray<FItemIndexEntry>& ItemIndex, FRandomStream& Random)
+    {
+        const FItemIndexEntry& Entry = ItemIndex[Random.RandHelper(ItemIndex.Num())];
+        return MakeItem(Entry, Random.RandRange(1, FMath::Max(Entry.StackSize, 1)));
+    }
+
+    /** A random slot that is occupied (bOccupied) or empty, or INDEX_NONE after a few misses */
+    static int32 RandomSlot(const UItemContainerBase& Container, const bool bOccupied, FRandomStream& Random)
+    {
+        for (int32 Attempt = 0; Attempt < 8; ++Attempt)
+        {
+            const int32 SlotIndex = Random.RandHelper(Container.MaxSlots);
+            if (Container.IsSlotEmpty(SlotIndex) != bOccupied)
+            {
+                return SlotIndex;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    static double Percentile(const TArray<double>& Sorted, const double Fraction)
+    {
+        if (Sorted.IsEmpty())
+        {
+            return 0.0;
+        }
+        return Sorted[FMath::Clamp(FMath::FloorToInt32(Fraction * (Sorted.Num() - 1)), 0, Sorted.Num() - 1)];
+    }
+
+    /**
+     * Sends the bot's moves of this frame as its client's FlushMoveCommands would, batched through
+     * Server_SubmitMoveCommands on the bot's connection, serialization and validation included
+     */
+    static void SubmitFrameMoves(FBot& Bot)
+    {
+        AGamePlayerCharacter* Character = Bot.Character.Get();
+        if (!Character || Bot.FrameMoves.IsEmpty())
+        {
+            Bot.FrameMoves.Reset();
+            return;
+        }
+
+        UFunction* Function = FInventoryLoadTestAccess::GetSubmitMoveCommands(*Character);
+        const FArrayProperty* CommandsProperty = CastFieldChecked<FArrayProperty>(Function->FindPropertyByName(TEXT("Commands")));
+        const int32 BatchSize = FMath::Max(FInventoryLoadTestAccess::GetMaxMoveCommandsPerBatch(*Character), 1);
+
+        uint8* Parms = static_cast<uint8*>(FMemory_Alloca_Aligned(Function->ParmsSize, Function->GetMinAlignment()));
+        FMemory::Memzero(Parms, Function->ParmsSize);
+        Function->InitializeStruct(Parms);
+
+        TArray<FSlotMoveCommand>& Commands = *CommandsProperty->ContainerPtrToValuePtr<TArray<FSlotMoveCommand>>(Parms);
+        for (int32 First = 0; First < Bot.FrameMoves.Num(); First += BatchSize)
+        {
+            Commands = TArray<FSlotMoveCommand>(Bot.FrameMoves.GetData() + First, FMath::Min(BatchSize, Bot.FrameMoves.Num() - First));
+
+            const int64 Bytes = Bot.Connection->ReceiveServerRPC(Character, Function, Parms);
+            if (Bytes == INDEX_NONE)
+            {
+                // The character's channel opens with the first replication pass; moves before it are lost
+                UE_LOG(LogInventory, Verbose, TEXT("InventoryLoadTest: Bot %d has no channel yet, dropping %d moves"),
+                    Bot.Connection->BotIndex, Bot.FrameMoves.Num() - First);
+                break;
+            }
+
+            ++Bot.RPCsReceived;
+            Bot.MoveBytesReceived += Bytes;
+        }
+
+        Function->DestroyStruct(Parms);
+        Bot.FrameMoves.Reset();
+    }
+
+    /** One bot action. Moves are queued for SubmitFrameMoves; everything else runs where the server would run its RPC. */
+    static void RunBotAction(FBot& Bot, const TArray<FItemIndexEntry>& ItemIndex, FRandomStream& Random)
+    {
+        AGamePlayerCharacter* Character = Bot.Character.Get();
+        UItemContainerBase* Inventory = Character ? Character->PlayerInventory : nullptr;
+        if (!Inventory)
+        {
+            return;
+        }
+
+        const float Roll = Random.FRand();
+
+        // A full inventory drops something first, as a player would
+        bool bHasEmptySlot = false;
+        int32 EmptyIndex = INDEX_NONE;
+        Inventory->FindEmptySlot(bHasEmptySlot, EmptyIndex);
+        if (!bHasEmptySlot)
+        {
+            bool bRemoved = false;
+            Inventory->RemoveItemAtIndex(Random.RandHelper(Inventory->MaxSlots), bRemoved);
+            ++Bot.RPCsReceived;
+            return;
+        }
+
+        // Pickup
+        if (Roll < 0.35f)
+        {
+            Inventory->AddItem(RandomItem(ItemIndex, Random));
+            ++Bot.RPCsReceived;
+            return;
+        }
+
+        // Drag within the inventory
+        if (Roll < 0.65f)
+        {
+            FSlotMoveCommand Move;
+            Move.FromContainer = Move.ToContainer = E_ContainerType::Inventory;
+            Move.FromIndex = RandomSlot(*Inventory, true, Random);
+            Move.ToIndex = Random.RandHelper(Inventory->MaxSlots);
+            if (Move.FromIndex != INDEX_NONE)
+            {
+                Bot.FrameMoves.Add(Move);
+            }
+            return;
+        }
+
+        // Stack split into an empty slot
+        if (Roll < 0.80f)
+        {
+            const int32 FromIndex = RandomSlot(*Inventory, true, Random);
+            const int32 ToIndex = RandomSlot(*Inventory, false, Random);
+            const int32 Quantity = FromIndex != INDEX_NONE ? Inventory->GetItemAtIndex(FromIndex).ItemQuantity : 0;
+            if (Quantity > 1 && ToIndex != INDEX_NONE)
+            {
+                FSlotMoveCommand Move;
+                Move.FromContainer = Move.ToContainer = E_ContainerType::Inventory;
+                Move.FromIndex = FromIndex;
+                Move.ToIndex = ToIndex;
+                Move.Quantity = Quantity / 2;
+                Bot.FrameMoves.Add(Move);
+            }
+            return;
+        }
+
+        // Chest looting: open, trade a few stacks with the chest, close
+        ASurvivalPlayerController* Controller = Bot.Controller.Get();
+        UStorageContainer* Chest = Bot.Chest.Get();
+        if (!Controller || !Chest)
+        {
+            return;
+        }
+
+        if (!Bot.bChestOpen)
+        {
+            Controller->OpenContainer(Chest);
+            Bot.bChestOpen = true;
+            ++Bot.RPCsReceived;
+            return;
+        }
+
+        if (Random.FRand() < 0.3f)
+        {
+            Controller->CloseContainer(Chest);
+            Bot.bChestOpen = false;
+            ++Bot.RPCsReceived;
+            return;
+        }
+
+        FSlotMoveCommand Take;
+        Take.FromContainer = E_ContainerType::Storage;
+        Take.ToContainer = E_ContainerType::Inventory;
+        Take.FromIndex = RandomSlot(*Chest, true, Random);
+        Take.ToIndex = RandomSlot(*Inventory, false, Random);
+        if (Take.FromIndex != INDEX_NONE && Take.ToIndex != INDEX_NONE)
+        {
+            Bot.FrameMoves.Add(Take);
+        }
+
+        // Put something back so chests never run dry
+        FSlotMoveCommand Give;
+        Give.FromContainer = E_ContainerType::Inventory;
+        Give.ToContainer = E_ContainerType::Storage;
+        Give.FromIndex = RandomSlot(*Inventory, true, Random);
+        Give.ToIndex = RandomSlot(*Chest, false, Random);
+        if (Give.FromIndex != INDEX_NONE && Give.ToIndex != INDEX_NONE)
+        {
+            Bot.FrameMoves.Add(Give);
+        }
+    }
+
+    static bool RunScenario(const int32 NumClients, const FSettings& Settings, const TArray<FItemIndexEntry>& ItemIndex, FRandomStream& Random, FScenarioResult& OutResult)
+    {
+        OutResult = FScenarioResult();
+        OutResult.NumClients = NumClients;
+
+        FScopedLoadTestNetDriver NetDriverOverride;
+
+        UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("InventoryLoadTest"));
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+
+        FURL URL;
+        World->SetGameMode(URL);
+        World->InitializeActorsForPlay(URL);
+
+        if (!World->Listen(URL) || !Cast<ULoadTestNetDriver>(World->GetNetDriver()))
+        {
+            UE_LOG(LogInventory, Error, TEXT("InventoryLoadTest: Could not start the load test net driver"));
+            GEngine->DestroyWorldContext(World);
+            World->DestroyWorld(false);
+            return false;
+        }
+
+        ULoadTestNetDriver* NetDriver = CastChecked<ULoadTestNetDriver>(World->GetNetDriver());
+        World->BeginPlay();
+
+        // Chests, each shared by a group of bots standing next to it
+        TArray<FGuid> ChestIds;
+        TArray<UStorageContainer*> Chests;
+        const int32 NumChests = FMath::DivideAndRoundUp(NumClients, Settings.BotsPerChest);
+        for (int32 ChestIndex = 0; ChestIndex < NumChests; ++ChestIndex)
+        {
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            const ALoadTestStorageActor* ChestActor = World->SpawnActor<ALoadTestStorageActor>(FVector(ChestIndex * 2000.0, 0.0, 0.0), FRotator::ZeroRotator, SpawnParams);
+
+            UStorageContainer* Chest = ChestActor->Storage;
+            Chest->EnsureResident();
+            for (int32 Stack = 0; Stack < Chest->MaxSlots / 2; ++Stack)
+            {
+                Chest->AddItem(RandomItem(ItemIndex, Random));
+            }
+
+            Chests.Add(Chest);
+            ChestIds.Add(Chest->StorageId);
+        }
+
+        // Bots
+        TArray<FBot> Bots;
+        Bots.Reserve(NumClients);
+        for (int32 BotIndex = 0; BotIndex < NumClients; ++BotIndex)
+        {
+            FBot& Bot = Bots.AddDefaulted_GetRef();
+            Bot.Connection = NetDriver->AddBotConnection(BotIndex);
+
+            FString Error;
+            APlayerController* PlayerController = World->SpawnPlayActor(Bot.Connection, ROLE_AutonomousProxy, URL, FUniqueNetIdRepl(), Error);
+            if (!PlayerController)
+            {
+                UE_LOG(LogInventory, Error, TEXT("InventoryLoadTest: Bot %d failed to log in: %s"), BotIndex, *Error);
+                continue;
+            }
+
+            const int32 ChestIndex = BotIndex / Settings.BotsPerChest;
+            const FVector Location(ChestIndex * 2000.0 + (BotIndex % Settings.BotsPerChest) * 100.0, 200.0, 0.0);
+
+            // The game mode may have no player start or a different pawn in this empty world
+            AGamePlayerCharacter* Character = Cast<AGamePlayerCharacter>(PlayerController->GetPawn());
+            if (!Character)
+            {
+                if (APawn* OtherPawn = PlayerController->GetPawn())
+                {
+                    OtherPawn->Destroy();
+                }
+
+                FActorSpawnParameters SpawnParams;
+                SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+                Character = World->SpawnActor<AGamePlayerCharacter>(Settings.PawnClass, Location, FRotator::ZeroRotator, SpawnParams);
+                PlayerController->Possess(Character);
+            }
+            else
+            {
+                Character->SetActorLocation(Location);
+            }
+
+            // Nothing to stand on here; keep bots in reach of their chest
+            Character->GetCharacterMovement()->DisableMovement();
+
+            Bot.Controller = Cast<ASurvivalPlayerController>(PlayerController);
+            Bot.Character = Character;
+            Bot.Chest = Chests[ChestIndex];
+        }
+
+        if (!Bots.IsEmpty() && !Bots[0].Controller.IsValid())
+        {
+            UE_LOG(LogInventory, Warning, TEXT("InventoryLoadTest: Game mode doesn't use ASurvivalPlayerController, chest looting is skipped"));
+        }
+
+        // Time from the end of actor tick to the end of the frame: outbox flushes and TickFlush replication
+        double PostActorTickTime = 0.0;
+        const FDelegateHandle PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddLambda(
+            [World, &PostActorTickTime](const UWorld* TickedWorld, ELevelTick, float)
+            {
+                if (TickedWorld == World)
+                {
+                    PostActorTickTime = FPlatformTime::Seconds();
+                }
+            });
+
+        const float DeltaSeconds = 1.0f / Settings.TickRate;
+        const float ActionChance = Settings.ActionsPerSecond / Settings.TickRate;
+        const int32 NumWarmupFrames = FMath::RoundToInt32(Settings.WarmupSeconds * Settings.TickRate);
+        const int32 NumFrames = NumWarmupFrames + FMath::RoundToInt32(Settings.Seconds * Settings.TickRate);
+
+        TArray<double> FrameMs;
+        FrameMs.Reserve(NumFrames);
+        double PostActorTickSeconds = 0.0;
+
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            if (Frame == NumWarmupFrames)
+            {
+                // Initial replication of every actor is not what this measures
+                for (FBot& Bot : Bots)
+                {
+                    Bot.Connection->BytesSent = Bot.Connection->PacketsSent = Bot.Connection->RPCsSent = 0;
+                    Bot.RPCsReceived = Bot.MoveBytesReceived = 0;
+                }
+            }
+
+            const double FrameStart = FPlatformTime::Seconds();
+
+            // Bot actions stand in for the RPCs a server handles in TickDispatch; move batches go through the RPC itself
+            for (FBot& Bot : Bots)
+            {
+                if (Random.FRand() < ActionChance)
+                {
+                    RunBotAction(Bot, ItemIndex, Random);
+                }
+
+                SubmitFrameMoves(Bot);
+            }
+
+            World->Tick(LEVELTICK_All, DeltaSeconds);
+            ++GFrameCounter;
+
+            const double FrameEnd = FPlatformTime::Seconds();
+            if (Frame >= NumWarmupFrames)
+            {
+                FrameMs.Add((FrameEnd - FrameStart) * 1000.0);
+                if (PostActorTickTime >= FrameStart)
+                {
+                    PostActorTickSeconds += FrameEnd - PostActorTickTime;
+                }
+            }
+        }
+
+        FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+        // Results
+        FrameMs.Sort();
+        OutResult.TickP50Ms = Percentile(FrameMs, 0.50);
+        OutResult.TickP90Ms = Percentile(FrameMs, 0.90);
+        OutResult.TickP99Ms = Percentile(FrameMs, 0.99);
+        OutResult.TickMaxMs = FrameMs.IsEmpty() ? 0.0 : FrameMs.Last();
+        OutResult.PostActorTickMs = FrameMs.IsEmpty() ? 0.0 : PostActorTickSeconds * 1000.0 / FrameMs.Num();
+
+        const double ClientSeconds = FMath::Max(static_cast<double>(NumClients) * Settings.Seconds, 1.0);
+        for (const FBot& Bot : Bots)
+        {
+            OutResult.BytesSentPerClientSec += Bot.Connection->BytesSent / ClientSeconds;
+            OutResult.PacketsSentPerClientSec += Bot.Connection->PacketsSent / ClientSeconds;
+            OutResult.RPCsSentPerClientSec += Bot.Connection->RPCsSent / ClientSeconds;
+            OutResult.RPCsReceivedPerClientSec += Bot.RPCsReceived / ClientSeconds;
+            OutResult.MoveBytesReceivedPerClientSec += Bot.MoveBytesReceived / ClientSeconds;
+        }
+
+        // Teardown; the storage subsystem writes the chests out on the way down
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        for (const FGuid& ChestId : ChestIds)
+        {
+            IFileManager::Get().Delete(*FInventoryLoadTestAccess::GetStoragePath(ChestId), false, false, true);
+        }
+
+        return true;
+    }
+}
+
+//===========================================UInventoryLoadTestCommandlet====================================================
+UInventoryLoadTestCommandlet::UInventoryLoadTestCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = true;
+    LogToConsole = true;
+}
+
+int32 UInventoryLoadTestCommandlet::Main(const FString& Params)
+{
+    using namespace InventoryLoadTest;
+
+    FSettings Settings;
+    Settings.PawnClass = AGamePlayerCharacter::StaticClass();
+
+    FString ClientsParam = TEXT("1,10,25,50,100,150");
+    FParse::Value(*Params, TEXT("Clients="), ClientsParam);
+    FParse::Value(*Params, TEXT("Seconds="), Settings.Seconds);
+    FParse::Value(*Params, TEXT("TickRate="), Settings.TickRate);
+    FParse::Value(*Params, TEXT("ActionsPerSecond="), Settings.ActionsPerSecond);
+    Settings.Seconds = FMath::Max(Settings.Seconds, 1);
+    Settings.TickRate = FMath::Max(Settings.TickRate, 1.0f);
+
+    FString PawnClassPath;
+    if (FParse::Value(*Params, TEXT("PawnClass="), PawnClassPath))
+    {
+        if (UClass* PawnClass = LoadClass<AGamePlayerCharacter>(nullptr, *PawnClassPath))
+        {
+            Settings.PawnClass = PawnClass;
+        }
+        else
+        {
+            UE_LOG(LogInventory, Warning, TEXT("InventoryLoadTest: %s is not an AGamePlayerCharacter class, using the native class"), *PawnClassPath);
+        }
+    }
+
+    int32 Seed = 1;
+    FParse::Value(*Params, TEXT("Seed="), Seed);
+    FRandomStream Random(Seed);
+
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("LoadTests") / FString::Printf(TEXT("Inventory-%s.csv"), *FDateTime::Now().ToString());
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    TArray<int32> ClientCounts;
+    {
+        TArray<FString> CountStrings;
+        ClientsParam.ParseIntoArray(CountStrings, TEXT(","));
+        for (const FString& CountString : CountStrings)
+        {
+            const int32 Count = FCString::Atoi(*CountString);
+            if (Count > 0)
+            {
+                ClientCounts.Add(Count);
+            }
+        }
+    }
+
+    const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+    if (!AssetManager || AssetManager->GetItemIndex().IsEmpty())
+    {
+        UE_LOG(LogInventory, Error, TEXT("InventoryLoadTest: No indexed items to pick up"));
+        return 1;
+    }
+    const TArray<FItemIndexEntry>& ItemIndex = AssetManager->GetItemIndex();
+
+    FString Csv = TEXT("Clients,FrameP50Ms,FrameP90Ms,FrameP99Ms,FrameMaxMs,PostActorTickMs,BytesSentPerClientSec,PacketsSentPerClientSec,RPCsSentPerClientSec,RPCsReceivedPerClientSec,MoveBytesReceivedPerClientSec\n");
+
+    for (const int32 NumClients : ClientCounts)
+    {
+        FScenarioResult Result;
+        if (!RunScenario(NumClients, Settings, ItemIndex, Random, Result))
+        {
+            return 1;
+        }
+
+        UE_LOG(LogInventory, Display, TEXT("InventoryLoadTest: %4d clients  frame p50 %6.2f p90 %6.2f p99 %6.2f max %6.2f ms  post-actor-tick %5.2f ms  out %8.0f B/s %5.1f RPC/s  in %5.1f RPC/s %6.0f B/s per client"),
+            NumClients, Result.TickP50Ms, Result.TickP90Ms, Result.TickP99Ms, Result.TickMaxMs, Result.PostActorTickMs,
+            Result.BytesSentPerClientSec, Result.RPCsSentPerClientSec, Result.RPCsReceivedPerClientSec, Result.MoveBytesReceivedPerClientSec);
+
+        Csv += FString::Printf(TEXT("%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f,%.2f,%.2f,%.2f,%.1f\n"),
+            Result.NumClients, Result.TickP50Ms, Result.TickP90Ms, Result.TickP99Ms, Result.TickMaxMs, Result.PostActorTickMs,
+            Result.BytesSentPerClientSec, Result.PacketsSentPerClientSec, Result.RPCsSentPerClientSec,
+            Result.RPCsReceivedPerClientSec, Result.MoveBytesReceivedPerClientSec);
+    }
+
+    if (!FFileHelper::SaveStringToFile(Csv, *OutputPath))
+    {
+        UE_LOG(LogInventory, Error, TEXT("InventoryLoadTest: Could not write %s"), *OutputPath);
+        return 1;
+    }
+
+    UE_LOG(LogInventory, Display, TEXT("InventoryLoadTest: Wrote %s"), *OutputPath);
+    return 0;
+}
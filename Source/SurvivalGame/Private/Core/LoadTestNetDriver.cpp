@@ -0,0 +1,141 @@
+// LoadTestNetDriver.cpp
+
+#include "Core/LoadTestNetDriver.h"
+
+#include "Core/SurvivalLog.h"
+#include "Engine/ActorChannel.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Net/RepLayout.h"
+#include "UObject/CoreNet.h"
+
+//===========================================ULoadTestNetConnection====================================================
+void ULoadTestNetConnection::InitConnection(UNetDriver* InDriver, const EConnectionState InState, const FURL& InURL, const int32 InConnectionSpeed, const int32 InMaxPacket)
+{
+    Super::InitConnection(InDriver, InState, InURL, InConnectionSpeed, InMaxPacket);
+
+    // Nobody answers on the other end, so reliable data is acked as soon as it is sent
+    SetInternalAck(true);
+    SetAutoFlush(true);
+    InitSendBuffer();
+}
+
+void ULoadTestNetConnection::LowLevelSend(void* Data, const int32 CountBits, FOutPacketTraits& Traits)
+{
+    BytesSent += FMath::DivideAndRoundUp(CountBits, 8);
+    ++PacketsSent;
+}
+
+int64 ULoadTestNetConnection::ReceiveServerRPC(AActor* Actor, UFunction* Function, void* Parms)
+{
+    UActorChannel* Channel = Actor && Function && (Function->FunctionFlags & FUNC_NetServer) ? FindActorChannelRef(Actor) : nullptr;
+    if (!Channel)
+    {
+        return INDEX_NONE;
+    }
+
+    const TSharedPtr<FRepLayout> RepLayout = Driver->GetFunctionRepLayout(Function);
+
+    // The client's half: the parameters as they would go into the bunch
+    FNetBitWriter Writer(PackageMap, 0);
+    RepLayout->SendPropertiesForRPC(Function, Channel, Writer, static_cast<uint8*>(Parms));
+
+    // The server's half, as in UActorChannel::ProcessBunch: decode into fresh parameters and call
+    uint8* ReceivedParms = static_cast<uint8*>(FMemory_Alloca_Aligned(Function->ParmsSize, Function->GetMinAlignment()));
+    FMemory::Memzero(ReceivedParms, Function->ParmsSize);
+    Function->InitializeStruct(ReceivedParms);
+
+    FNetBitReader Reader(PackageMap, Writer.GetData(), Writer.GetNumBits());
+    TSet<FNetworkGUID> UnmappedGuids;
+    RepLayout->ReceivePropertiesForRPC(Actor, Function, Channel, Reader, ReceivedParms, UnmappedGuids);
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogInventory, Error, TEXT("LoadTestBot%d: %s parameters failed to deserialize"), BotIndex, *Function->GetName());
+    }
+    else
+    {
+        Actor->ProcessEvent(Function, ReceivedParms);
+
+        // A real connection would be closed here
+        if (const TCHAR* FailedReason = RPC_GetLastFailedReason())
+        {
+            UE_LOG(LogInventory, Error, TEXT("LoadTestBot%d: %s failed validation: %s"), BotIndex, *Function->GetName(), FailedReason);
+            RPC_ResetLastFailedReason();
+        }
+    }
+
+    Function->DestroyStruct(ReceivedParms);
+    return Writer.GetNumBytes();
+}
+
+FString ULoadTestNetConnection::LowLevelGetRemoteAddress(bool bAppendPort)
+{
+    return FString::Printf(TEXT("LoadTestBot%d"), BotIndex);
+}
+
+FString ULoadTestNetConnection::LowLevelDescribe()
+{
+    return LowLevelGetRemoteAddress();
+}
+
+//===========================================ULoadTestNetDriver====================================================
+ULoadTestNetDriver::ULoadTestNetDriver()
+{
+    NetConnectionClass = ULoadTestNetConnection::StaticClass();
+}
+
+bool ULoadTestNetDriver::InitConnect(FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error)
+{
+    Error = TEXT("ULoadTestNetDriver only runs as a server");
+    return false;
+}
+
+bool ULoadTestNetDriver::InitListen(FNetworkNotify* InNotify, FURL& LocalURL, const bool bReuseAddressAndPort, FString& Error)
+{
+    return InitBase(false, InNotify, LocalURL, bReuseAddressAndPort, Error);
+}
+
+void ULoadTestNetDriver::LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits)
+{
+    // Connectionless packets (handshakes) never happen: bots are added already connected
+}
+
+FString ULoadTestNetDriver::LowLevelGetNetworkNumber()
+{
+    return TEXT("LoadTest");
+}
+
+void ULoadTestNetDriver::ProcessRemoteFunction(AActor* Actor, UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack, UObject* SubObject)
+{
+    if (Actor && Function)
+    {
+        if (ULoadTestNetConnection* Connection = Cast<ULoadTestNetConnection>(Actor->GetNetConnection()))
+        {
+            ++Connection->RPCsSent;
+        }
+        else if (Function->FunctionFlags & FUNC_NetMulticast)
+        {
+            ++MulticastRPCs;
+        }
+    }
+
+    Super::ProcessRemoteFunction(Actor, Function, Parameters, OutParms, Stack, SubObject);
+}
+
+ULoadTestNetConnection* ULoadTestNetDriver::AddBotConnection(const int32 BotIndex)
+{
+    ULoadTestNetConnection* Connection = NewObject<ULoadTestNetConnection>(GetTransientPackage());
+    Connection->BotIndex = BotIndex;
+    Connection->InitConnection(this, USOCK_Open, FURL(), 0);
+    Connection->SetClientLoginState(EClientLoginState::Welcomed);
+
+    // The client is treated as having loaded the current map, so every actor in it can replicate
+    if (const UWorld* NetWorld = GetWorld())
+    {
+        Connection->SetClientWorldPackageName(NetWorld->GetOutermost()->GetFName());
+    }
+
+    AddClientConnection(Connection);
+    return Connection;
+}
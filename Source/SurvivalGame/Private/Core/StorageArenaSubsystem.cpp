@@ -0,0 +1,253 @@
+// StorageArenaSubsystem.cpp
+
+#include "Core/StorageArenaSubsystem.h"
+
+#include "Components/Inventory/ItemContainerSnapshot.h"
+#include "Core/SurvivalLog.h"
+
+bool UStorageArenaSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStorageArenaSubsystem::Deinitialize()
+{
+    Blocks.Empty();
+    FreeBlocks.Empty();
+    FreeRangesBySize.Empty();
+    Slots.Init(0);
+
+    Super::Deinitialize();
+}
+
+//===========================================Blocks====================================================
+FStorageHandle UStorageArenaSubsystem::AllocateContainer(const int32 NumSlots)
+{
+    FStorageHandle Handle;
+    if (NumSlots <= 0)
+    {
+        return Handle;
+    }
+
+    const int32 BlockIndex = FreeBlocks.IsEmpty() ? Blocks.AddDefaulted() : FreeBlocks.Pop(EAllowShrinking::No);
+    FArenaBlock& Block = Blocks[BlockIndex];
+
+    // Reuse a released range of the same size before growing the arena
+    TArray<int32>* FreeRanges = FreeRangesBySize.Find(NumSlots);
+    if (FreeRanges && !FreeRanges->IsEmpty())
+    {
+        Block.FirstSlot = FreeRanges->Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Block.FirstSlot = Slots.Num();
+        Slots.Reserve(Block.FirstSlot + NumSlots);
+    }
+
+    Block.NumSlots = NumSlots;
+    Block.bInUse = true;
+
+    Handle.BlockIndex = BlockIndex;
+    Handle.Generation = Block.Generation;
+    return Handle;
+}
+
+void UStorageArenaSubsystem::ReleaseContainer(FStorageHandle& Handle)
+{
+    if (!FindBlock(Handle))
+    {
+        Handle = FStorageHandle();
+        return;
+    }
+
+    FArenaBlock& Block = Blocks[Handle.BlockIndex];
+
+    const FItemStructure EmptyItem;
+    for (int32 SlotIndex = Block.FirstSlot; SlotIndex < Block.FirstSlot + Block.NumSlots; ++SlotIndex)
+    {
+        Slots.Set(SlotIndex, EmptyItem);
+    }
+
+    FreeRangesBySize.FindOrAdd(Block.NumSlots).Add(Block.FirstSlot);
+
+    // Outstanding copies of the handle go stale
+    ++Block.Generation;
+    Block.bInUse = false;
+    FreeBlocks.Add(Handle.BlockIndex);
+
+    Handle = FStorageHandle();
+}
+
+const UStorageArenaSubsystem::FArenaBlock* UStorageArenaSubsystem::FindBlock(const FStorageHandle& Handle) const
+{
+    if (!Blocks.IsValidIndex(Handle.BlockIndex))
+    {
+        return nullptr;
+    }
+
+    const FArenaBlock& Block = Blocks[Handle.BlockIndex];
+    return Block.bInUse && Block.Generation == Handle.Generation ? &Block : nullptr;
+}
+
+bool UStorageArenaSubsystem::IsValidHandle(const FStorageHandle& Handle) const
+{
+    return FindBlock(Handle) != nullptr;
+}
+
+int32 UStorageArenaSubsystem::GetNumSlots(const FStorageHandle& Handle) const
+{
+    const FArenaBlock* Block = FindBlock(Handle);
+    return Block ? Block->NumSlots : 0;
+}
+
+//===========================================Slots====================================================
+FItemStructure UStorageArenaSubsystem::GetItem(const FStorageHandle& Handle, const int32 SlotIndex) const
+{
+    const FArenaBlock* Block = FindBlock(Handle);
+    if (!Block || SlotIndex < 0 || SlotIndex >= Block->NumSlots)
+    {
+        return FItemStructure();
+    }
+
+    return Slots.MakeItem(Block->FirstSlot + SlotIndex);
+}
+
+bool UStorageArenaSubsystem::SetItem(const FStorageHandle& Handle, const int32 SlotIndex, const FItemStructure& Item)
+{
+    const FArenaBlock* Block = FindBlock(Handle);
+    if (!Block || SlotIndex < 0 || SlotIndex >= Block->NumSlots)
+    {
+        return false;
+    }
+
+    Slots.Set(Block->FirstSlot + SlotIndex, Item);
+    return true;
+}
+
+int32 UStorageArenaSubsystem::AddItem(const FStorageHandle& Handle, const FItemStructure& Item)
+{
+    const FArenaBlock* Block = FindBlock(Handle);
+    if (!Block || Item.RegistryKey.IsNone() || Item.ItemQuantity <= 0)
+    {
+        return Item.ItemQuantity;
+    }
+
+    const int32 EndSlot = Block->FirstSlot + Block->NumSlots;
+    int32 Remaining = Item.ItemQuantity;
+
+    // Top up partial stacks of the same item first
+    if (Item.StackSize > 1)
+    {
+        for (int32 SlotIndex = Block->FirstSlot; SlotIndex < EndSlot && Remaining > 0; ++SlotIndex)
+        {
+            if (Slots.GetRegistryKey(SlotIndex) != Item.RegistryKey)
+            {
+                continue;
+            }
+
+            const int32 Space = Slots.GetStackSize(SlotIndex) - Slots.GetQuantity(SlotIndex);
+            if (Space > 0)
+            {
+                FItemStructure Stack = Slots.MakeItem(SlotIndex);
+                const int32 AmountToMove = FMath::Min(Space, Remaining);
+                Stack.ItemQuantity += AmountToMove;
+                Remaining -= AmountToMove;
+                Slots.Set(SlotIndex, Stack);
+            }
+        }
+    }
+
+    // Then spill into empty slots, one full stack each; like PlaceItem, an unstackable item
+    // keeps its whole quantity in one slot
+    for (int32 SlotIndex = Block->FirstSlot; SlotIndex < EndSlot && Remaining > 0; ++SlotIndex)
+    {
+        if (!Slots.GetRegistryKey(SlotIndex).IsNone() && Slots.GetQuantity(SlotIndex) > 0)
+        {
+            continue;
+        }
+
+        FItemStructure Stack = Item;
+        Stack.ItemQuantity = Item.StackSize > 1 ? FMath::Min(Remaining, Item.StackSize) : Remaining;
+        Remaining -= Stack.ItemQuantity;
+        Slots.Set(SlotIndex, Stack);
+    }
+
+    return Remaining;
+}
+
+int32 UStorageArenaSubsystem::CountOf(const FStorageHandle& Handle, const FName RegistryKey) const
+{
+    const FArenaBlock* Block = FindBlock(Handle);
+    if (!Block || RegistryKey.IsNone())
+    {
+        return 0;
+    }
+
+    int32 Total = 0;
+    for (int32 SlotIndex = Block->FirstSlot; SlotIndex < Block->FirstSlot + Block->NumSlots; ++SlotIndex)
+    {
+        if (Slots.GetRegistryKey(SlotIndex) == RegistryKey)
+        {
+            Total += Slots.GetQuantity(SlotIndex);
+        }
+    }
+    return Total;
+}
+
+//===========================================Snapshots====================================================
+bool UStorageArenaSubsystem::WriteSnapshot(const FStorageHandle& Handle, TArray<uint8>& OutBytes) const
+{
+    const FArenaBlock* Block = FindBlock(Handle);
+    if (!Block)
+    {
+        return false;
+    }
+
+    FItemContainerSnapshot::Write(Slots, Block->FirstSlot, Block->NumSlots, OutBytes);
+    return true;
+}
+
+bool UStorageArenaSubsystem::ReadSnapshot(const FStorageHandle& Handle, const TConstArrayView<uint8> Bytes)
+{
+    const FArenaBlock* Block = FindBlock(Handle);
+    if (!Block)
+    {
+        return false;
+    }
+
+    // Validate the whole snapshot before touching the block
+    {
+        FItemContainerSnapshotReader Validator(Bytes);
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure Item;
+        while (Validator.Next(SlotIndex, Item))
+        {
+            if (SlotIndex < 0 || SlotIndex >= Block->NumSlots)
+            {
+                UE_LOG(LogInventory, Warning, TEXT("UStorageArenaSubsystem: Snapshot slot %d does not fit in %d slots"), SlotIndex, Block->NumSlots);
+                return false;
+            }
+        }
+
+        if (Validator.HasError())
+        {
+            return false;
+        }
+    }
+
+    const FItemStructure EmptyItem;
+    for (int32 SlotIndex = Block->FirstSlot; SlotIndex < Block->FirstSlot + Block->NumSlots; ++SlotIndex)
+    {
+        Slots.Set(SlotIndex, EmptyItem);
+    }
+
+    FItemContainerSnapshotReader Reader(Bytes);
+    int32 SlotIndex = INDEX_NONE;
+    FItemStructure Item;
+    while (Reader.Next(SlotIndex, Item))
+    {
+        Slots.Set(Block->FirstSlot + SlotIndex, Item);
+    }
+
+    return true;
+}
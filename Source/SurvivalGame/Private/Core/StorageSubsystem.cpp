@@ -0,0 +1,323 @@
+// StorageSubsystem.cpp
+
+#include "Core/StorageSubsystem.h"
+
+#include "Async/Async.h"
+#include "Components/Inventory/Child/StorageContainer.h"
+#include "Core/SurvivalLog.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+bool UStorageSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStorageSubsystem::Deinitialize()
+{
+    // Page out everything still resident, then wait so nothing is lost on shutdown
+    for (TPair<FGuid, FStorageRecord>& Pair : Records)
+    {
+        if (Pair.Value.Container.IsValid() && Pair.Value.Container->IsResident())
+        {
+            PageOut(Pair.Key, Pair.Value);
+        }
+    }
+
+    CollectWrites(true);
+
+    // Writes that were held back behind an in-flight one go out synchronously
+    for (TPair<FGuid, FStorageRecord>& Pair : Records)
+    {
+        FStorageRecord& Record = Pair.Value;
+        if (Record.Revision != Record.SavedRevision && !Record.Snapshot.IsEmpty())
+        {
+            FFileHelper::SaveArrayToFile(Record.Snapshot, *GetStoragePath(Pair.Key));
+        }
+    }
+
+    Records.Reset();
+    Super::Deinitialize();
+}
+
+TStatId UStorageSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UStorageSubsystem, STATGROUP_Tickables);
+}
+
+void UStorageSubsystem::Tick(const float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    TimeUntilCheck -= DeltaTime;
+    if (TimeUntilCheck > 0.0f)
+    {
+        return;
+    }
+
+    TimeUntilCheck = CheckInterval;
+    CollectWrites(false);
+    CheckResidentStorage();
+}
+
+//===========================================Registration====================================================
+void UStorageSubsystem::RegisterStorage(UStorageContainer* Container)
+{
+    if (!IsValid(Container))
+    {
+        return;
+    }
+
+    // The container assigns its id before registering; without one its contents could never be found again
+    if (!Container->StorageId.IsValid())
+    {
+        UE_LOG(LogInventory, Error, TEXT("UStorageSubsystem: %s registered without a storage id"), *Container->GetName());
+        return;
+    }
+
+    FStorageRecord& Record = Records.FindOrAdd(Container->StorageId);
+    if (Record.Container.IsValid() && Record.Container != Container)
+    {
+        UE_LOG(LogInventory, Warning, TEXT("UStorageSubsystem: %s reuses storage id %s of %s"),
+            *Container->GetName(), *Container->StorageId.ToString(), *Record.Container->GetName());
+        return;
+    }
+
+    Record.Container = Container;
+}
+
+void UStorageSubsystem::UnregisterStorage(UStorageContainer* Container)
+{
+    if (!Container)
+    {
+        return;
+    }
+
+    FStorageRecord* Record = Records.Find(Container->StorageId);
+    if (!Record || Record->Container != Container)
+    {
+        return;
+    }
+
+    if (Container->IsResident())
+    {
+        PageOut(Container->StorageId, *Record);
+    }
+
+    Record->Container.Reset();
+}
+
+//===========================================Paging====================================================
+bool UStorageSubsystem::AcquireStorage(UStorageContainer* Container)
+{
+    if (!Container)
+    {
+        return false;
+    }
+
+    FStorageRecord* Record = Records.Find(Container->StorageId);
+    if (!Record || Record->Container != Container)
+    {
+        return false;
+    }
+
+    Record->LastAccessTime = GetNow();
+    if (Container->IsResident())
+    {
+        return true;
+    }
+
+    if (Record->bRestoreFailed)
+    {
+        return false;
+    }
+
+    // First access this session reads the chest from disk; a new chest has no file yet
+    if (Record->Snapshot.IsEmpty())
+    {
+        const FString Path = GetStoragePath(Container->StorageId);
+        if (IFileManager::Get().FileExists(*Path) && !FFileHelper::LoadFileToArray(Record->Snapshot, *Path))
+        {
+            UE_LOG(LogInventory, Error, TEXT("UStorageSubsystem: Failed to read %s"), *Path);
+            Record->bRestoreFailed = true;
+            return false;
+        }
+    }
+
+    if (!Container->Materialize(Record->Snapshot))
+    {
+        UE_LOG(LogInventory, Error, TEXT("UStorageSubsystem: Could not restore storage %s, leaving it paged out"), *Container->StorageId.ToString());
+        Record->bRestoreFailed = true;
+        return false;
+    }
+
+    // Resident chests are the source of truth until they page out again
+    Record->Snapshot.Empty();
+
+    UE_LOG(LogInventory, Verbose, TEXT("UStorageSubsystem: Paged in %s (%d of %d resident)"),
+        *Container->StorageId.ToString(), GetNumResident(), Records.Num());
+    return true;
+}
+
+void UStorageSubsystem::MarkStorageDirty(UStorageContainer* Container)
+{
+    if (FStorageRecord* Record = Container ? Records.Find(Container->StorageId) : nullptr)
+    {
+        ++Record->Revision;
+        Record->LastAccessTime = GetNow();
+    }
+}
+
+void UStorageSubsystem::PageOut(const FGuid& StorageId, FStorageRecord& Record)
+{
+    UStorageContainer* Container = Record.Container.Get();
+    if (!Container || !Container->IsResident())
+    {
+        return;
+    }
+
+    Container->PageOut(Record.Snapshot);
+
+    if (Record.Revision != Record.SavedRevision && !Record.bWriteInFlight)
+    {
+        QueueWrite(StorageId, Record, Record.Snapshot);
+    }
+    else if (Record.Revision == Record.SavedRevision && !bKeepSnapshotsInMemory)
+    {
+        // Unchanged since it was read or last written, so the disk copy (or its absence, for a
+        // chest that never held anything) already matches; no write will come back to drop it
+        Record.Snapshot.Empty();
+    }
+
+    UE_LOG(LogInventory, Verbose, TEXT("UStorageSubsystem: Paged out %s (%d bytes)"), *StorageId.ToString(), Record.Snapshot.Num());
+}
+
+void UStorageSubsystem::CheckResidentStorage()
+{
+    const double Now = GetNow();
+
+    for (TPair<FGuid, FStorageRecord>& Pair : Records)
+    {
+        FStorageRecord& Record = Pair.Value;
+        UStorageContainer* Container = Record.Container.Get();
+        if (!Container || !Container->IsResident())
+        {
+            continue;
+        }
+
+        // Open chests never count as idle
+        if (Container->HasViewers())
+        {
+            Record.LastAccessTime = Now;
+        }
+        else if (Now - Record.LastAccessTime >= IdleSeconds)
+        {
+            PageOut(Pair.Key, Record);
+            continue;
+        }
+
+        // Busy chests are still written back now and then so a crash loses little
+        if (Record.Revision != Record.SavedRevision && !Record.bWriteInFlight && Now - Record.LastWriteTime >= WriteBackInterval)
+        {
+            TArray<uint8> Bytes;
+            Container->SaveSnapshot(Bytes);
+            QueueWrite(Pair.Key, Record, MoveTemp(Bytes));
+        }
+    }
+}
+
+//===========================================Write-back====================================================
+void UStorageSubsystem::QueueWrite(const FGuid& StorageId, FStorageRecord& Record, TArray<uint8> Bytes)
+{
+    FPendingWrite& Write = PendingWrites.AddDefaulted_GetRef();
+    Write.StorageId = StorageId;
+    Write.Revision = Record.Revision;
+    Write.Result = Async(EAsyncExecution::ThreadPool, [Path = GetStoragePath(StorageId), Bytes = MoveTemp(Bytes)]()
+    {
+        return FFileHelper::SaveArrayToFile(Bytes, *Path);
+    });
+
+    Record.bWriteInFlight = true;
+    Record.LastWriteTime = GetNow();
+}
+
+void UStorageSubsystem::CollectWrites(const bool bWait)
+{
+    TArray<FGuid, TInlineAllocator<8>> StaleWrites;
+
+    for (int32 WriteIndex = PendingWrites.Num() - 1; WriteIndex >= 0; --WriteIndex)
+    {
+        FPendingWrite& Write = PendingWrites[WriteIndex];
+        if (!bWait && !Write.Result.IsReady())
+        {
+            continue;
+        }
+
+        const bool bSaved = Write.Result.Get();
+
+        if (FStorageRecord* Record = Records.Find(Write.StorageId))
+        {
+            Record->bWriteInFlight = false;
+
+            if (bSaved)
+            {
+                Record->SavedRevision = Write.Revision;
+
+                // The disk copy is current, so the paged-out bytes no longer need to stay in memory
+                const bool bResident = Record->Container.IsValid() && Record->Container->IsResident();
+                if (!bResident && !bKeepSnapshotsInMemory && Record->SavedRevision == Record->Revision)
+                {
+                    Record->Snapshot.Empty();
+                }
+                else if (!bResident && Record->SavedRevision != Record->Revision)
+                {
+                    // Paged out while this write was running; its newer snapshot still has to go out
+                    StaleWrites.Add(Write.StorageId);
+                }
+            }
+            else
+            {
+                UE_LOG(LogInventory, Error, TEXT("UStorageSubsystem: Failed to write %s"), *GetStoragePath(Write.StorageId));
+            }
+        }
+
+        PendingWrites.RemoveAtSwap(WriteIndex);
+    }
+
+    // On shutdown the caller writes these synchronously instead
+    if (!bWait)
+    {
+        for (const FGuid& StorageId : StaleWrites)
+        {
+            FStorageRecord& Record = Records.FindChecked(StorageId);
+            QueueWrite(StorageId, Record, Record.Snapshot);
+        }
+    }
+}
+
+//===========================================Helpers====================================================
+int32 UStorageSubsystem::GetNumResident() const
+{
+    int32 NumResident = 0;
+    for (const TPair<FGuid, FStorageRecord>& Pair : Records)
+    {
+        if (Pair.Value.Container.IsValid() && Pair.Value.Container->IsResident())
+        {
+            ++NumResident;
+        }
+    }
+    return NumResident;
+}
+
+FString UStorageSubsystem::GetStoragePath(const FGuid& StorageId)
+{
+    return FPaths::ProjectSavedDir() / TEXT("Storage") / StorageId.ToString(EGuidFormats::Digits) + TEXT(".sgic");
+}
+
+double UStorageSubsystem::GetNow() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
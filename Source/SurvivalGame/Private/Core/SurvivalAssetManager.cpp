@@ -1,15 +1,22 @@
 // SurvivalAssetManager.cpp
 
 #include "SurvivalAssetManager.h"
+#include "Core/SurvivalLog.h"
 #include "Engine/AssetManager.h"
+#include "Misc/NetworkVersion.h"
 #include "PrimaryData/ItemInfo.h"
 
+USurvivalAssetManager* USurvivalAssetManager::GetIfValid()
+{
+	return Cast<USurvivalAssetManager>(UAssetManager::GetIfInitialized());
+}
+
 void USurvivalAssetManager::StartInitialLoading()
 {
 	// Let the base class do its standard work first
 	Super::StartInitialLoading();
 
-	UE_LOG(LogTemp, Log, TEXT("USurvivalAssetManager: StartInitialLoading() called"));
+	UE_LOG(LogItemAssets, Log, TEXT("USurvivalAssetManager: StartInitialLoading() called"));
     
 	// Make sure primary asset types are properly registered
 	FPrimaryAssetType ItemType("Item");
@@ -20,7 +27,17 @@ void USurvivalAssetManager::StartInitialLoading()
     
 	
 	// Format: (PrimaryAssetType, Paths, BaseClass, bHasBlueprintClasses, bIsEditorOnly, bForceSynchronousScan)
-	ScanPathsForPrimaryAssets(ItemType, Paths, UItemInfo::StaticClass(), true, false, false);
+	// Synchronous so the index below is built from every item, not whatever the scan had reached
+	ScanPathsForPrimaryAssets(ItemType, Paths, UItemInfo::StaticClass(), true, false, true);
+
+	// The index takes part in the network version, so the connect handshake refuses a client
+	// whose net indices would not line up with the server's
+	FNetworkVersion::GetLocalNetworkVersionOverride.BindUObject(this, &USurvivalAssetManager::GetNetworkVersion);
+
+	BuildItemIndex();
+
+	// In the editor the registry may still be discovering files; rebuild once it has all of them
+	CallOrRegister_OnCompletedInitialScan(FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &USurvivalAssetManager::BuildItemIndex));
     
 	
 	TArray<FPrimaryAssetId> ItemAssetIds;
@@ -29,15 +46,15 @@ void USurvivalAssetManager::StartInitialLoading()
 	// If have items, request them to load asynchronously
 	if (ItemAssetIds.Num() > 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Found %d 'Item' assets:"), ItemAssetIds.Num());
+		UE_LOG(LogItemAssets, Log, TEXT("Found %d 'Item' assets:"), ItemAssetIds.Num());
 		for (int32 i = 0; i < FMath::Min(ItemAssetIds.Num(), 10); i++)
 		{
-			UE_LOG(LogTemp, Log, TEXT("  [%d] %s"), i, *ItemAssetIds[i].ToString());
+			UE_LOG(LogItemAssets, Verbose, TEXT("  [%d] %s"), i, *ItemAssetIds[i].ToString());
 		}
         
 		if (ItemAssetIds.Num() > 10)
 		{
-			UE_LOG(LogTemp, Log, TEXT("  ...and %d more"), ItemAssetIds.Num() - 10);
+			UE_LOG(LogItemAssets, Verbose, TEXT("  ...and %d more"), ItemAssetIds.Num() - 10);
 		}
 
 		FStreamableDelegate OnLoadCompleteDelegate = FStreamableDelegate::CreateUObject(
@@ -50,13 +67,13 @@ void USurvivalAssetManager::StartInitialLoading()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No 'Item' assets found to load! Check paths in ScanPathsForPrimaryAssets"));
+		UE_LOG(LogItemAssets, Warning, TEXT("No 'Item' assets found to load! Check paths in ScanPathsForPrimaryAssets"));
 	}
 }
 
 void USurvivalAssetManager::OnItemsLoaded() const
 {
-	UE_LOG(LogTemp, Log, TEXT("All 'Item' assets have finished loading!"));
+	UE_LOG(LogItemAssets, Log, TEXT("All 'Item' assets have finished loading!"));
 
 	// At this point, the items are loaded in memory. 
 	TArray<FPrimaryAssetId> LoadedItemIds;
@@ -68,7 +85,182 @@ void USurvivalAssetManager::OnItemsLoaded() const
 		UObject* LoadedObj = GetPrimaryAssetObject(AssetId);
 		if (LoadedObj)
 		{
-			UE_LOG(LogTemp, Log, TEXT("Loaded asset: %s"), *LoadedObj->GetName());
+			UE_LOG(LogItemAssets, Verbose, TEXT("Loaded asset: %s"), *LoadedObj->GetName());
 		}
 	}
 }
+
+//===========================================Item Index====================================================
+void USurvivalAssetManager::BuildItemIndex()
+{
+	// Asset data comes from the registry, so none of the items are loaded here
+	TArray<FAssetData> ItemAssets;
+	GetPrimaryAssetDataList(FPrimaryAssetType("Item"), ItemAssets);
+
+	ItemIndexEntries.Reset(ItemAssets.Num());
+	for (const FAssetData& AssetData : ItemAssets)
+	{
+		FItemIndexEntry& Entry = ItemIndexEntries.AddDefaulted_GetRef();
+		Entry.AssetPath = AssetData.GetSoftObjectPath();
+
+		// Assets saved before RegistryKey was searchable lack the tag; their primary asset name is the key
+		FName TaggedKey;
+		Entry.RegistryKey = AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UItemInfo, RegistryKey), TaggedKey)
+			? TaggedKey
+			: GetPrimaryAssetIdForData(AssetData).PrimaryAssetName;
+
+		ReadItemDefinition(AssetData, Entry);
+	}
+
+	AssignNameOrdinals();
+
+	// Scan order isn't guaranteed, lexical order is the same on every machine
+	ItemIndexEntries.Sort([](const FItemIndexEntry& A, const FItemIndexEntry& B)
+	{
+		return A.RegistryKey.LexicalLess(B.RegistryKey);
+	});
+
+	ItemIndexByKey.Reset();
+	ItemIndexChecksum = 0;
+
+	for (int32 NetIndex = 0; NetIndex < ItemIndexEntries.Num(); ++NetIndex)
+	{
+		const FItemIndexEntry& Entry = ItemIndexEntries[NetIndex];
+		if (ItemIndexByKey.Contains(Entry.RegistryKey))
+		{
+			UE_LOG(LogItemAssets, Warning, TEXT("USurvivalAssetManager: Duplicate item RegistryKey %s at %s"),
+				*Entry.RegistryKey.ToString(), *Entry.AssetPath.ToString());
+			continue;
+		}
+
+		ItemIndexByKey.Add(Entry.RegistryKey, NetIndex);
+		ItemIndexChecksum = FCrc::StrCrc32(*Entry.RegistryKey.ToString(), ItemIndexChecksum);
+	}
+
+	// The cached network version includes the old checksum
+	FNetworkVersion::InvalidateNetworkChecksum();
+
+	UE_LOG(LogItemAssets, Log, TEXT("USurvivalAssetManager: Built item index with %d entries (checksum %08x)"),
+		ItemIndexEntries.Num(), ItemIndexChecksum);
+}
+
+uint32 USurvivalAssetManager::GetNetworkVersion() const
+{
+	// Engine version without this override, with the index mixed in
+	return HashCombine(FNetworkVersion::GetLocalNetworkVersion(false), ItemIndexChecksum);
+}
+
+void USurvivalAssetManager::ReadItemDefinition(const FAssetData& AssetData, FItemIndexEntry& Entry)
+{
+	// Already in memory (editor, or loaded earlier): read it directly, this never triggers a load
+	if (const UItemInfo* LoadedItem = Cast<UItemInfo>(AssetData.FastGetAsset(false)))
+	{
+		Entry.ItemCategory = LoadedItem->ItemCategory;
+		Entry.ItemType = LoadedItem->ItemType;
+		Entry.ItemRarity = LoadedItem->ItemRarity;
+		Entry.StackSize = LoadedItem->bStackable ? LoadedItem->StackSize : 1;
+		Entry.ItemWeight = LoadedItem->ItemWeight;
+		Entry.ItemName = LoadedItem->ItemName;
+		return;
+	}
+
+	FString TagValue;
+	if (AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UItemInfo, ItemCategory), TagValue))
+	{
+		Entry.ItemCategory = static_cast<E_ItemCategory>(StaticEnum<E_ItemCategory>()->GetValueByNameString(TagValue, EGetByNameFlags::None));
+	}
+	if (AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UItemInfo, ItemType), TagValue))
+	{
+		Entry.ItemType = static_cast<E_ItemType>(StaticEnum<E_ItemType>()->GetValueByNameString(TagValue, EGetByNameFlags::None));
+	}
+	if (AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UItemInfo, ItemRarity), TagValue))
+	{
+		Entry.ItemRarity = static_cast<E_ItemRarity>(StaticEnum<E_ItemRarity>()->GetValueByNameString(TagValue, EGetByNameFlags::None));
+	}
+
+	bool bStackable = false;
+	int32 TaggedStackSize = 1;
+	if (AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UItemInfo, bStackable), bStackable)
+		&& AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UItemInfo, StackSize), TaggedStackSize))
+	{
+		Entry.StackSize = bStackable ? FMath::Max(TaggedStackSize, 1) : 1;
+	}
+
+	AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UItemInfo, ItemWeight), Entry.ItemWeight);
+	AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UItemInfo, ItemName), Entry.ItemName);
+}
+
+void USurvivalAssetManager::AssignNameOrdinals()
+{
+	TArray<int32> ByName;
+	ByName.Reserve(ItemIndexEntries.Num());
+	for (int32 NetIndex = 0; NetIndex < ItemIndexEntries.Num(); ++NetIndex)
+	{
+		ByName.Add(NetIndex);
+	}
+
+	// Unnamed items sort by registry key so every item gets a stable position
+	auto SortName = [this](const int32 NetIndex)
+	{
+		const FItemIndexEntry& Entry = ItemIndexEntries[NetIndex];
+		return Entry.ItemName.IsEmpty() ? Entry.RegistryKey.ToString() : Entry.ItemName.ToString();
+	};
+
+	ByName.StableSort([&SortName](const int32 A, const int32 B)
+	{
+		return SortName(A).Compare(SortName(B), ESearchCase::IgnoreCase) < 0;
+	});
+
+	for (int32 Ordinal = 0; Ordinal < ByName.Num(); ++Ordinal)
+	{
+		ItemIndexEntries[ByName[Ordinal]].NameOrdinal = Ordinal;
+	}
+}
+
+void USurvivalAssetManager::EnsureItemIndex() const
+{
+	if (ItemIndexEntries.IsEmpty())
+	{
+		const_cast<USurvivalAssetManager*>(this)->BuildItemIndex();
+	}
+}
+
+FSoftObjectPath USurvivalAssetManager::FindItemAssetPath(const FName RegistryKey) const
+{
+	const int32 NetIndex = GetItemNetIndex(RegistryKey);
+	return NetIndex != INDEX_NONE ? ItemIndexEntries[NetIndex].AssetPath : FSoftObjectPath();
+}
+
+int32 USurvivalAssetManager::GetItemNetIndex(const FName RegistryKey) const
+{
+	EnsureItemIndex();
+
+	const int32* NetIndex = ItemIndexByKey.Find(RegistryKey);
+	return NetIndex ? *NetIndex : INDEX_NONE;
+}
+
+bool USurvivalAssetManager::GetItemFromNetIndex(const int32 NetIndex, FName& OutRegistryKey, FSoftObjectPath& OutAssetPath) const
+{
+	EnsureItemIndex();
+
+	if (!ItemIndexEntries.IsValidIndex(NetIndex))
+	{
+		return false;
+	}
+
+	OutRegistryKey = ItemIndexEntries[NetIndex].RegistryKey;
+	OutAssetPath = ItemIndexEntries[NetIndex].AssetPath;
+	return true;
+}
+
+const TArray<FItemIndexEntry>& USurvivalAssetManager::GetItemIndex() const
+{
+	EnsureItemIndex();
+	return ItemIndexEntries;
+}
+
+const FItemIndexEntry* USurvivalAssetManager::GetItemIndexEntry(const int32 NetIndex) const
+{
+	EnsureItemIndex();
+	return ItemIndexEntries.IsValidIndex(NetIndex) ? &ItemIndexEntries[NetIndex] : nullptr;
+}
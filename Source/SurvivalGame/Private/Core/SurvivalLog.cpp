@@ -0,0 +1,7 @@
+// SurvivalLog.cpp
+
+#include "Core/SurvivalLog.h"
+
+DEFINE_LOG_CATEGORY(LogInventory);
+DEFINE_LOG_CATEGORY(LogInventoryUI);
+DEFINE_LOG_CATEGORY(LogItemAssets);
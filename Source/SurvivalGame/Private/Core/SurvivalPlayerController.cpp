@@ -1,4 +1,5 @@
 #include "SurvivalPlayerController.h"
+#include "Core/SurvivalLog.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "GameFramework/Character.h"
@@ -7,7 +8,10 @@
 #include "UI/Widgets/GameInventoryLayout.h"
 #include "UI/Widgets/InventoryWidget.h"
 #include "Enums/ContainerType.h"
+#include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
+#include "Core/SurvivalAssetManager.h"
+#include "Components/Inventory/ItemContainerBase.h"
 #include "UI/Widgets/Inventory/InventorySlot.h"
 #include "UI/Widgets/Inventory/ItemContainerGrid.h"
 
@@ -20,37 +24,24 @@ ASurvivalPlayerController::ASurvivalPlayerController()
 //==================================================Debug Functions==================================================
 void ASurvivalPlayerController::DebugListAllItemAssets()
 {
-    UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+    const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
     if (!AssetManager)
     {
-        UE_LOG(LogTemp, Error, TEXT("AssetManager not initialized!"));
+        UE_LOG(LogItemAssets, Error, TEXT("AssetManager not initialized!"));
         return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("=== ALL AVAILABLE ITEM ASSETS ==="));
+    UE_LOG(LogItemAssets, Log, TEXT("=== ALL AVAILABLE ITEM ASSETS ==="));
 
-    // Try to list all UItemInfo assets no matter where they are
-    UObjectLibrary* ItemLibrary = UObjectLibrary::CreateLibrary(UItemInfo::StaticClass(), true, true);
-    ItemLibrary->LoadAssetDataFromPath("/Game");
+    // Listed from the item index, so nothing gets loaded
+    const TArray<FItemIndexEntry>& ItemIndex = AssetManager->GetItemIndex();
 
-    TArray<FAssetData> AllItems;
-    ItemLibrary->GetAssetDataList(AllItems);
-
-    UE_LOG(LogTemp, Log, TEXT("ObjectLibrary found %d UItemInfo assets:"), AllItems.Num());
-    for (const FAssetData& Asset : AllItems)
+    UE_LOG(LogItemAssets, Log, TEXT("Item index has %d UItemInfo assets (checksum %08x):"),
+        ItemIndex.Num(), AssetManager->GetItemIndexChecksum());
+    for (int32 NetIndex = 0; NetIndex < ItemIndex.Num(); ++NetIndex)
     {
-        UE_LOG(LogTemp, Log, TEXT("  Path: %s"), *Asset.GetSoftObjectPath().ToString());
-    
-        // Try to load it and check its registry key
-        UItemInfo* Item = Cast<UItemInfo>(Asset.GetAsset());
-        if (Item)
-        {
-            UE_LOG(LogTemp, Log, TEXT("    RegistryKey: %s"), *Item->RegistryKey.ToString());
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("    Failed to load asset"));
-        }
+        UE_LOG(LogItemAssets, Log, TEXT("  [%d] RegistryKey: %s"), NetIndex, *ItemIndex[NetIndex].RegistryKey.ToString());
+        UE_LOG(LogItemAssets, Log, TEXT("    Path: %s"), *ItemIndex[NetIndex].AssetPath.ToString());
     }
 }
 
@@ -62,12 +53,12 @@ void ASurvivalPlayerController::BeginPlay()
     // 1) Check if we are on the server (HasAuthority()) vs. client
     if (HasAuthority())
     {
-        UE_LOG(LogTemp, Log, TEXT("BeginPlay: Running on server (could be dedicated or listen)."));
+        UE_LOG(LogInventoryUI, Verbose, TEXT("BeginPlay: Running on server (could be dedicated or listen)."));
         // If you have server-only logic (replication setup, etc.), put it here.
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("BeginPlay: Running on a remote client."));
+        UE_LOG(LogInventoryUI, Verbose, TEXT("BeginPlay: Running on a remote client."));
     }
 
     // Initialize enhanced input
@@ -80,6 +71,17 @@ void ASurvivalPlayerController::BeginPlay()
 //==================================================EndPlay==================================================
 void ASurvivalPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    // Drops anything still queued; the client is going away with this controller
+    if (SlotOutboxFlushHandle.IsValid())
+    {
+        FWorldDelegates::OnWorldPostActorTick.Remove(SlotOutboxFlushHandle);
+        SlotOutboxFlushHandle.Reset();
+    }
+    SlotOutbox.Reset();
+    SlotOutboxLookup.Reset();
+    OpenContainers.Reset();
+    MovePrediction.Reset();
+
     if (RootLayout)
     {
         if (RootLayout->GetParent())
@@ -129,7 +131,7 @@ void ASurvivalPlayerController::InitializeEnhancedInput() const
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("Missing DefaultInputMapping in SurvivalPlayerController - CommonUI mode activated!"));
+                UE_LOG(LogInventoryUI, Warning, TEXT("Missing DefaultInputMapping in SurvivalPlayerController - CommonUI mode activated!"));
             }
         }
     }
@@ -142,11 +144,11 @@ void ASurvivalPlayerController::CreateMasterLayout()
     //    If this is a dedicated server with no local player, this will be false, skipping UI creation
     if (!IsLocalController())
     {
-        UE_LOG(LogTemp, Log, TEXT("CreateMasterLayout: Not a local controller, skipping UI creation."));
+        UE_LOG(LogInventoryUI, Log, TEXT("CreateMasterLayout: Not a local controller, skipping UI creation."));
         return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("CreateMasterLayout: Local player controller => creating UI."));
+    UE_LOG(LogInventoryUI, Log, TEXT("CreateMasterLayout: Local player controller => creating UI."));
     
     // Create our Master UI Layout widget if it doesn't exist and class is valid
     if (MasterLayoutClass && !RootLayout)
@@ -158,16 +160,16 @@ void ASurvivalPlayerController::CreateMasterLayout()
             RootLayout->AddToViewport();
             RootLayout->PushDefaultHUDLayout();
             
-            UE_LOG(LogTemp, Log, TEXT("CreateMasterLayout: UI widget successfully added to viewport."));
+            UE_LOG(LogInventoryUI, Log, TEXT("CreateMasterLayout: UI widget successfully added to viewport."));
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("CreateMasterLayout: Failed to create MasterUILayout widget"));
+            UE_LOG(LogInventoryUI, Warning, TEXT("CreateMasterLayout: Failed to create MasterUILayout widget"));
         }
     }
     else if (!MasterLayoutClass)
     {
-        UE_LOG(LogTemp, Warning, TEXT("CreateMasterLayout: MasterLayoutClass is not set"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("CreateMasterLayout: MasterLayoutClass is not set"));
     }
 }
 
@@ -175,26 +177,26 @@ void ASurvivalPlayerController::CreateMasterLayout()
 void ASurvivalPlayerController::InventoryOnClient_Implementation()
 {
     // This function only executes on clients
-    UE_LOG(LogTemp, Log, TEXT("InventoryOnClient_Implementation - Starting"));
+    UE_LOG(LogInventoryUI, Verbose, TEXT("InventoryOnClient_Implementation - Starting"));
     
     if (!RootLayout)
     {
-        UE_LOG(LogTemp, Warning, TEXT("InventoryOnClient_Implementation: RootLayout is null"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("InventoryOnClient_Implementation: RootLayout is null"));
         return;
     }
     
     if (!bInventoryShown)
     {
-        UE_LOG(LogTemp, Log, TEXT("InventoryOnClient_Implementation - Opening inventory"));
+        UE_LOG(LogInventoryUI, Verbose, TEXT("InventoryOnClient_Implementation - Opening inventory"));
         
         UGameInventoryLayout* InvLayout = RootLayout->PushGameInventoryLayout();
         if (InvLayout)
         {
-            UE_LOG(LogTemp, Log, TEXT("InventoryOnClient_Implementation - GameInventoryLayout pushed successfully"));
+            UE_LOG(LogInventoryUI, Verbose, TEXT("InventoryOnClient_Implementation - GameInventoryLayout pushed successfully"));
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("InventoryOnClient_Implementation - Failed to push GameInventoryLayout"));
+            UE_LOG(LogInventoryUI, Warning, TEXT("InventoryOnClient_Implementation - Failed to push GameInventoryLayout"));
         }
         
         SetInputMode(FInputModeUIOnly());
@@ -251,7 +253,7 @@ void ASurvivalPlayerController::InitializeInventoryWidget()
     
     if (!RootLayout)
     {
-        UE_LOG(LogTemp, Warning, TEXT("InitializeInventoryWidget: RootLayout is null"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("InitializeInventoryWidget: RootLayout is null"));
         return; 
     }
 
@@ -261,11 +263,11 @@ void ASurvivalPlayerController::InitializeInventoryWidget()
     if (GameInventoryLayout)
     {
         GameInventoryLayout->DeactivateWidget();
-        UE_LOG(LogTemp, Log, TEXT("InitializeInventoryWidget: GameInventoryLayout pushed successfully"));
+        UE_LOG(LogInventoryUI, Verbose, TEXT("InitializeInventoryWidget: GameInventoryLayout pushed successfully"));
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("InitializeInventoryWidget: Failed to push GameInventoryLayout"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("InitializeInventoryWidget: Failed to push GameInventoryLayout"));
     }
 }
 
@@ -275,14 +277,14 @@ UInventorySlot* ASurvivalPlayerController::GetInventorySlotWidget(E_ContainerTyp
     // This function should only be called on local controllers
     if (!IsLocalController())
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetInventorySlotWidget: Not a local controller"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("GetInventorySlotWidget: Not a local controller"));
         return nullptr;
     }
     
     // 1. Check if the main UI container (RootLayout) is available.
     if (!RootLayout)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetInventorySlotWidget: RootLayout is null"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("GetInventorySlotWidget: RootLayout is null"));
         return nullptr;
     }
 
@@ -293,7 +295,7 @@ UInventorySlot* ASurvivalPlayerController::GetInventorySlotWidget(E_ContainerTyp
         UGameInventoryLayout* InvLayout = RootLayout->PushGameInventoryLayout();
         if (!InvLayout)
         {
-            UE_LOG(LogTemp, Warning, TEXT("GetInventorySlotWidget: Failed to create GameInventoryLayout"));
+            UE_LOG(LogInventoryUI, Warning, TEXT("GetInventorySlotWidget: Failed to create GameInventoryLayout"));
             return nullptr;
         }
     }
@@ -302,27 +304,27 @@ UInventorySlot* ASurvivalPlayerController::GetInventorySlotWidget(E_ContainerTyp
     UGameInventoryLayout* GameInventoryLayout = RootLayout->GetGameInventoryLayout();
     if (!GameInventoryLayout)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetInventorySlotWidget: GameInventoryLayout is null"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("GetInventorySlotWidget: GameInventoryLayout is null"));
         return nullptr;
     }
 
     UInventoryWidget* InventoryWidget = GameInventoryLayout->GetInventoryWidget();
     if (!InventoryWidget)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetInventorySlotWidget: InventoryWidget is null"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("GetInventorySlotWidget: InventoryWidget is null"));
         return nullptr;
     }
 
     UItemContainerGrid* ItemContainerGrid = InventoryWidget->GetItemContainerGrid();
     if (!ItemContainerGrid)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetInventorySlotWidget: ItemContainerGrid is null"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("GetInventorySlotWidget: ItemContainerGrid is null"));
         return nullptr;
     }
 
     if (!ItemContainerGrid->Slots.IsValidIndex(SlotIndex))
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetInventorySlotWidget: Invalid slot index"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("GetInventorySlotWidget: Invalid slot index"));
         return nullptr;
     }
 
@@ -342,69 +344,292 @@ UInventorySlot* ASurvivalPlayerController::GetInventorySlotWidget(E_ContainerTyp
     }
 }
 
-//==================================================UpdateItemSlot Interface==================================================
-void ASurvivalPlayerController::UpdateItemSlot_Implementation(E_ContainerType ContainerType, FItemStructure ItemInfo, int32 Index)
+//==================================================Container Viewing==================================================
+void ASurvivalPlayerController::OpenContainer(UItemContainerBase* Container)
 {
-    // Interface implementations are called on both server and clients
-    
-    // We need to update the UI on the client that owns this controller
-    if (IsLocalController())
+    if (HasAuthority())
     {
-        Client_UpdateSlot(ContainerType, ItemInfo, Index);
+        Server_OpenContainer_Implementation(Container);
+        return;
     }
-    else
+
+    // The owning client tracks its open containers too, for predicting moves into them
+    if (IsValid(Container))
     {
-        // For remote controllers, we need the reliable RPC to update their clients
-        Client_UpdateSlot(ContainerType, ItemInfo, Index);
+        OpenContainers.Remove(Container);
+        OpenContainers.Add(Container);
     }
+
+    Server_OpenContainer(Container);
 }
 
+void ASurvivalPlayerController::CloseContainer(UItemContainerBase* Container)
+{
+    if (HasAuthority())
+    {
+        Server_CloseContainer_Implementation(Container);
+        return;
+    }
 
+    OpenContainers.Remove(Container);
+    Server_CloseContainer(Container);
+}
 
-//==================================================Client_UpdateSlot==================================================
-void ASurvivalPlayerController::Client_UpdateSlot_Implementation(E_ContainerType Container, FItemStructure ItemInfo, int32 Index)
+void ASurvivalPlayerController::Server_OpenContainer_Implementation(UItemContainerBase* Container)
 {
-    // This RPC only executes on the owning client
-    UInventorySlot* InventorSlot = GetInventorySlotWidget(Container, Index);
+    if (!IsValid(Container) || !Container->GetOwner())
+    {
+        return;
+    }
 
-    if (IsValid(InventorSlot))
+    // Keep players from subscribing to containers across the map
+    const APawn* ViewerPawn = GetPawn();
+    if (MaxContainerViewDistance > 0.0f && ViewerPawn && Container->GetOwner() != ViewerPawn
+        && FVector::DistSquared(ViewerPawn->GetActorLocation(), Container->GetOwner()->GetActorLocation()) > FMath::Square(MaxContainerViewDistance))
     {
-        // Update the slot with the new item info
-        InventorSlot->UpdateSlot(ItemInfo);
+        UE_LOG(LogInventory, Warning, TEXT("OpenContainer: %s is too far from %s"), *GetName(), *Container->GetOwner()->GetName());
+        return;
     }
-    else
+
+    Container->AddViewer(this);
+
+    OpenContainers.Remove(Container);
+    OpenContainers.Add(Container);
+}
+
+void ASurvivalPlayerController::Server_CloseContainer_Implementation(UItemContainerBase* Container)
+{
+    if (IsValid(Container))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Client_UpdateSlot: Invalid inventory slot at index %d"), Index);
+        Container->RemoveViewer(this);
     }
+
+    OpenContainers.Remove(Container);
 }
 
+UItemContainerBase* ASurvivalPlayerController::FindOpenContainer(const E_ContainerType ContainerType) const
+{
+    for (int32 Index = OpenContainers.Num() - 1; Index >= 0; --Index)
+    {
+        UItemContainerBase* Container = OpenContainers[Index].Get();
+        if (IsValid(Container) && Container->ContainerType == ContainerType)
+        {
+            return Container;
+        }
+    }
+    return nullptr;
+}
+
+//==================================================Slot Interface==================================================
+void ASurvivalPlayerController::UpdateItemSlot_Implementation(E_ContainerType ContainerType, FItemStructure ItemInfo, int32 Index)
+{
+    QueueSlotUpdate(ContainerType, Index, ItemInfo);
+}
+
+void ASurvivalPlayerController::UpdateItemSlots_Implementation(E_ContainerType ContainerType, const TArray<FItemSlotUpdate>& SlotUpdates)
+{
+    for (const FItemSlotUpdate& SlotUpdate : SlotUpdates)
+    {
+        QueueSlotUpdate(ContainerType, SlotUpdate.SlotIndex, SlotUpdate.Item);
+    }
+}
 
-// ==================================================ResetItemSlot Interface==================================================
 void ASurvivalPlayerController::ResetItemSlot_Implementation(E_ContainerType ContainerType, int32 Index)
 {
-    Client_ResetSlot(ContainerType, Index);
-    
+    // An empty item clears the widget on the client
+    QueueSlotUpdate(ContainerType, Index, FItemStructure());
 }
 
-// ==================================================Client_ResetSlot==================================================
-void ASurvivalPlayerController::Client_ResetSlot_Implementation(E_ContainerType Container, int32 Index)
+//==================================================Slot Outbox==================================================
+void ASurvivalPlayerController::QueueSlotUpdate(E_ContainerType ContainerType, int32 SlotIndex, const FItemStructure& Item)
 {
-    // Validate index is in reasonable range
-    if (Index < 0)
+    if (SlotIndex < 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Client_ResetSlot: Invalid negative index %d"), Index);
+        SURVIVAL_LOG_RATELIMITED(LogInventoryUI, Warning, 1.0, TEXT("QueueSlotUpdate: Invalid negative index %d"), SlotIndex);
         return;
     }
-    
-    UInventorySlot* InventorySlot = GetInventorySlotWidget(Container, Index);
 
-    if (IsValid(InventorySlot))
+    TMap<int32, int32>& SlotLookup = SlotOutboxLookup.FindOrAdd(ContainerType);
+
+    FContainerSlotUpdates* ContainerUpdates = SlotOutbox.FindByPredicate([ContainerType](const FContainerSlotUpdates& Entry)
     {
-        InventorySlot->ClearSlot();
+        return Entry.ContainerType == ContainerType;
+    });
+
+    if (!ContainerUpdates)
+    {
+        ContainerUpdates = &SlotOutbox.AddDefaulted_GetRef();
+        ContainerUpdates->ContainerType = ContainerType;
+    }
+
+    // Last write wins: a slot touched several times this frame is only sent once
+    if (const int32* ExistingIndex = SlotLookup.Find(SlotIndex))
+    {
+        ContainerUpdates->Updates[*ExistingIndex].Item = Item;
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("Client_ResetSlot: Failed to get valid inventory slot at index %d"), Index);
+        SlotLookup.Add(SlotIndex, ContainerUpdates->Updates.Num());
+
+        FItemSlotUpdate& SlotUpdate = ContainerUpdates->Updates.AddDefaulted_GetRef();
+        SlotUpdate.SlotIndex = SlotIndex;
+        SlotUpdate.Item = Item;
+    }
+
+    ScheduleSlotOutboxFlush();
+}
+
+void ASurvivalPlayerController::ScheduleSlotOutboxFlush()
+{
+    if (!SlotOutboxFlushHandle.IsValid())
+    {
+        SlotOutboxFlushHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ASurvivalPlayerController::HandleWorldPostActorTick);
+    }
+}
+
+void ASurvivalPlayerController::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World == GetWorld())
+    {
+        FlushSlotOutbox();
+    }
+}
+
+void ASurvivalPlayerController::FlushSlotOutbox()
+{
+    if (SlotOutboxFlushHandle.IsValid())
+    {
+        FWorldDelegates::OnWorldPostActorTick.Remove(SlotOutboxFlushHandle);
+        SlotOutboxFlushHandle.Reset();
+    }
+
+    if (SlotOutbox.IsEmpty() && !bMoveAckPending)
+    {
+        return;
+    }
+
+    TArray<FContainerSlotUpdates> ContainerUpdates = MoveTemp(SlotOutbox);
+    SlotOutbox.Reset();
+    SlotOutboxLookup.Reset();
+
+    // The ack rides with the slot changes so the client never retires a prediction before seeing its result
+    FSlotMoveAck MoveAck;
+    if (bMoveAckPending)
+    {
+        MoveAck = MoveTemp(PendingMoveAck);
+        PendingMoveAck.RejectedKeys.Reset();
+        bMoveAckPending = false;
+    }
+
+    UE_LOG(LogInventoryUI, Verbose, TEXT("FlushSlotOutbox: Sending %d container change sets"), ContainerUpdates.Num());
+
+    Client_ApplySlotUpdates(ContainerUpdates, MoveAck);
+}
+
+//==================================================Move Prediction==================================================
+int32 ASurvivalPlayerController::PredictSlotMove(const FSlotMoveCommand& Command, const UItemContainerBase* FromContainer, const UItemContainerBase* ToContainer)
+{
+    if (!IsLocalController() || HasAuthority() || !IsValid(FromContainer) || !IsValid(ToContainer))
+    {
+        return 0;
+    }
+
+    if (!FromContainer->Items.IsValidIndex(Command.FromIndex) || !ToContainer->Items.IsValidIndex(Command.ToIndex))
+    {
+        return 0;
+    }
+
+    // The replicated slots are the client's copy of the containers
+    auto ReadConfirmed = [&Command, FromContainer, ToContainer](const E_ContainerType ContainerType, const int32 SlotIndex)
+    {
+        return ContainerType == Command.FromContainer && SlotIndex == Command.FromIndex
+            ? FromContainer->GetItemAtIndex(SlotIndex)
+            : ToContainer->GetItemAtIndex(SlotIndex);
+    };
+
+    TArray<FSlotMovePrediction::FDisplayChange> Changes;
+    const int32 PredictionKey = MovePrediction.PredictMove(Command, ReadConfirmed, Changes);
+    DisplayPredictionChanges(Changes);
+
+    return PredictionKey;
+}
+
+void ASurvivalPlayerController::AcknowledgeSlotMove(const int32 PredictionKey, const bool bAccepted)
+{
+    if (PredictionKey <= 0)
+    {
+        return;
+    }
+
+    PendingMoveAck.LastProcessedKey = FMath::Max(PendingMoveAck.LastProcessedKey, PredictionKey);
+    if (!bAccepted)
+    {
+        PendingMoveAck.RejectedKeys.Add(PredictionKey);
+    }
+
+    bMoveAckPending = true;
+    ScheduleSlotOutboxFlush();
+}
+
+void ASurvivalPlayerController::DisplaySlot(const E_ContainerType ContainerType, const int32 SlotIndex, const FItemStructure& Item)
+{
+    UInventorySlot* InventorySlot = GetInventorySlotWidget(ContainerType, SlotIndex);
+    if (!IsValid(InventorySlot))
+    {
+        SURVIVAL_LOG_RATELIMITED(LogInventoryUI, Warning, 1.0, TEXT("DisplaySlot: Invalid inventory slot at index %d"), SlotIndex);
+        return;
+    }
+
+    // UpdateSlot clears the widget when the item is empty
+    InventorySlot->UpdateSlot(Item);
+}
+
+void ASurvivalPlayerController::DisplayPredictionChanges(const TConstArrayView<FSlotMovePrediction::FDisplayChange> Changes)
+{
+    for (const FSlotMovePrediction::FDisplayChange& Change : Changes)
+    {
+        DisplaySlot(Change.ContainerType, Change.SlotIndex, Change.Item);
+    }
+}
+
+//==================================================Client_ApplySlotUpdates==================================================
+void ASurvivalPlayerController::Client_ApplySlotUpdates_Implementation(const TArray<FContainerSlotUpdates>& ContainerUpdates, const FSlotMoveAck& MoveAck)
+{
+    for (const FContainerSlotUpdates& Container : ContainerUpdates)
+    {
+        for (const FItemSlotUpdate& SlotUpdate : Container.Updates)
+        {
+            // Predicted slots keep showing the prediction until their move is answered
+            if (!MovePrediction.ConfirmSlot(Container.ContainerType, SlotUpdate.SlotIndex, SlotUpdate.Item))
+            {
+                DisplaySlot(Container.ContainerType, SlotUpdate.SlotIndex, SlotUpdate.Item);
+            }
+        }
+    }
+
+    // Opened chests send no slot updates; their slots show whatever has replicated by now
+    auto ReadReplicatedSlot = [this](const E_ContainerType ContainerType, const int32 SlotIndex, FItemStructure& OutItem)
+    {
+        const UItemContainerBase* Container = FindOpenContainer(ContainerType);
+        if (!Container || Container->SendsSlotUpdates())
+        {
+            return false;
+        }
+
+        OutItem = Container->GetItemAtIndex(SlotIndex);
+        return true;
+    };
+
+    if (MoveAck.LastProcessedKey > 0)
+    {
+        TArray<FSlotMovePrediction::FDisplayChange> Changes;
+        MovePrediction.Reconcile(MoveAck.LastProcessedKey, MoveAck.RejectedKeys, ReadReplicatedSlot, Changes);
+        DisplayPredictionChanges(Changes);
+
+        if (!MoveAck.RejectedKeys.IsEmpty())
+        {
+            UE_LOG(LogInventoryUI, Verbose, TEXT("Client_ApplySlotUpdates: Server rejected %d predicted moves, rolled back"), MoveAck.RejectedKeys.Num());
+        }
     }
 }
 
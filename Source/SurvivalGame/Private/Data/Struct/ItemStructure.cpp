@@ -1,5 +1,33 @@
 // ItemStructure.cpp
 #include "SurvivalGame/Public/Data/Struct/ItemStructure.h"
+#include "Core/SurvivalLog.h"
+
+#include "Core/SurvivalAssetManager.h"
+
+namespace ItemStructureNet
+{
+    /** Which optional parts of the item follow the header */
+    enum EFlags : uint8
+    {
+        HasItem       = 1 << 0,
+        IndexedKey    = 1 << 1,  // Definition sent as a net index; otherwise name and asset path are sent
+        HasQuantity   = 1 << 2,  // ItemQuantity != 1
+        HasStackSize  = 1 << 3,  // StackSize != 1
+        HasHP         = 1 << 4,  // HP differs from the 100/100 default
+        HasAmmo       = 1 << 5,
+    };
+
+    constexpr uint32 NumFlagBits = 6;
+
+    /** CurrentHP is sent as a fraction of MaxHP with this many bits */
+    constexpr uint32 HPFractionBits = 10;
+    constexpr uint32 HPFractionMax = (1 << HPFractionBits) - 1;
+
+    static uint32 ToPacked(const int32 Value)
+    {
+        return static_cast<uint32>(FMath::Max(Value, 0));
+    }
+}
 
 FItemStructure::FItemStructure()
     : RegistryKey(NAME_None)
@@ -10,4 +38,135 @@ FItemStructure::FItemStructure()
     , CurrentAmmo(0)
     , MaxAmmo(0)
 {
-}
\ No newline at end of file
+}
+
+bool FItemStructure::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    using namespace ItemStructureNet;
+
+    const FItemStructure Defaults;
+    uint8 Flags = 0;
+    int32 NetIndex = INDEX_NONE;
+
+    if (Ar.IsSaving())
+    {
+        if (!RegistryKey.IsNone())
+        {
+            Flags |= HasItem;
+
+            const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+            NetIndex = AssetManager ? AssetManager->GetItemNetIndex(RegistryKey) : INDEX_NONE;
+            if (NetIndex != INDEX_NONE)
+            {
+                Flags |= IndexedKey;
+            }
+
+            Flags |= ItemQuantity != Defaults.ItemQuantity ? HasQuantity : 0;
+            Flags |= StackSize != Defaults.StackSize ? HasStackSize : 0;
+            Flags |= (CurrentHP != Defaults.CurrentHP || MaxHP != Defaults.MaxHP) ? HasHP : 0;
+            Flags |= (CurrentAmmo != 0 || MaxAmmo != 0) ? HasAmmo : 0;
+        }
+    }
+
+    Ar.SerializeBits(&Flags, NumFlagBits);
+
+    if (!(Flags & HasItem))
+    {
+        if (Ar.IsLoading())
+        {
+            *this = Defaults;
+        }
+
+        bOutSuccess = true;
+        return true;
+    }
+
+    // Definition
+    if (Flags & IndexedKey)
+    {
+        uint32 PackedIndex = static_cast<uint32>(NetIndex);
+        Ar.SerializeIntPacked(PackedIndex);
+
+        if (Ar.IsLoading())
+        {
+            FName ReceivedKey;
+            FSoftObjectPath AssetPath;
+            const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid();
+            if (!AssetManager || !AssetManager->GetItemFromNetIndex(static_cast<int32>(PackedIndex), ReceivedKey, AssetPath))
+            {
+                SURVIVAL_LOG_RATELIMITED(LogItemAssets, Error, 1.0, TEXT("FItemStructure::NetSerialize: Unknown item net index %u, client and server item tables differ"),
+                    PackedIndex);
+                bOutSuccess = false;
+                return false;
+            }
+
+            RegistryKey = ReceivedKey;
+            ItemAsset = TSoftObjectPtr<UItemInfo>(AssetPath);
+        }
+    }
+    else
+    {
+        // Items outside the scanned paths still replicate, just without the compact id
+        Ar << RegistryKey;
+        Ar << ItemAsset;
+    }
+
+    // Counts
+    uint32 PackedQuantity = ToPacked(ItemQuantity);
+    if (Flags & HasQuantity)
+    {
+        Ar.SerializeIntPacked(PackedQuantity);
+    }
+
+    uint32 PackedStackSize = ToPacked(StackSize);
+    if (Flags & HasStackSize)
+    {
+        Ar.SerializeIntPacked(PackedStackSize);
+    }
+
+    // Durability
+    uint32 PackedMaxHP = ToPacked(FMath::RoundToInt(MaxHP));
+    uint32 HPFraction = HPFractionMax;
+    if (Flags & HasHP)
+    {
+        if (Ar.IsSaving() && MaxHP > 0.0f)
+        {
+            HPFraction = static_cast<uint32>(FMath::RoundToInt(FMath::Clamp(CurrentHP / MaxHP, 0.0f, 1.0f) * HPFractionMax));
+        }
+
+        Ar.SerializeIntPacked(PackedMaxHP);
+        Ar.SerializeBits(&HPFraction, HPFractionBits);
+    }
+
+    // Ammo
+    uint32 PackedCurrentAmmo = ToPacked(CurrentAmmo);
+    uint32 PackedMaxAmmo = ToPacked(MaxAmmo);
+    if (Flags & HasAmmo)
+    {
+        Ar.SerializeIntPacked(PackedCurrentAmmo);
+        Ar.SerializeIntPacked(PackedMaxAmmo);
+    }
+
+    if (Ar.IsLoading())
+    {
+        ItemQuantity = (Flags & HasQuantity) ? static_cast<int32>(PackedQuantity) : Defaults.ItemQuantity;
+        StackSize = (Flags & HasStackSize) ? static_cast<int32>(PackedStackSize) : Defaults.StackSize;
+
+        if (Flags & HasHP)
+        {
+            MaxHP = static_cast<float>(PackedMaxHP);
+            CurrentHP = MaxHP * static_cast<float>(HPFraction) / HPFractionMax;
+        }
+        else
+        {
+            MaxHP = Defaults.MaxHP;
+            CurrentHP = Defaults.CurrentHP;
+        }
+
+        CurrentAmmo = (Flags & HasAmmo) ? static_cast<int32>(PackedCurrentAmmo) : 0;
+        MaxAmmo = (Flags & HasAmmo) ? static_cast<int32>(PackedMaxAmmo) : 0;
+    }
+
+    bOutSuccess = true;
+    return true;
+}
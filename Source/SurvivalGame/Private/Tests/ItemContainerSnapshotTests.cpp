@@ -0,0 +1,371 @@
+// ItemContainerSnapshotTests.cpp
+
+#include "Components/Inventory/ItemContainerSnapshot.h"
+#include "Components/Inventory/ItemSlotStore.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ItemContainerSnapshotTests
+{
+    constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+    /** Offsets of the version bytes, right after the 4 byte magic */
+    constexpr int32 SchemaVersionOffset = 4;
+    constexpr int32 MinReaderVersionOffset = 5;
+
+    /**
+     * Item outside the item index, so the reader takes the asset path stored in the snapshot.
+     * Seeds cycle through a handful of definitions to exercise the id table.
+     */
+    static FItemStructure MakeTestItem(const int32 Seed)
+    {
+        const int32 Definition = Seed % 5;
+
+        FItemStructure Item;
+        Item.RegistryKey = FName(*FString::Printf(TEXT("SnapshotTestItem_%d"), Definition));
+        Item.ItemAsset = TSoftObjectPtr<UItemInfo>(FSoftObjectPath(FString::Printf(TEXT("/Game/Tests/SnapshotTestItem_%d.SnapshotTestItem_%d"), Definition, Definition)));
+        Item.StackSize = Definition == 0 ? 1 : 50;
+        Item.ItemQuantity = Item.StackSize > 1 ? 1 + Seed % Item.StackSize : 1;
+        Item.CurrentHP = 100.0f - static_cast<float>(Seed % 7);
+        return Item;
+    }
+
+    static FItemSlotStore MakeStore(const int32 NumSlots, const TFunctionRef<FItemStructure(int32 SlotIndex)> ItemAt)
+    {
+        FItemSlotStore Store;
+        Store.Init(NumSlots);
+        for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+        {
+            Store.Set(SlotIndex, ItemAt(SlotIndex));
+        }
+        return Store;
+    }
+
+    static TArray<uint8> WriteStore(const FItemSlotStore& Store)
+    {
+        TArray<uint8> Bytes;
+        FItemContainerSnapshot::Write(Store, 0, Store.Num(), Bytes);
+        return Bytes;
+    }
+
+    /** Reads every record back into a store of the snapshot's size */
+    static bool ReadStore(FAutomationTestBase& Test, const TArray<uint8>& Bytes, FItemSlotStore& OutStore)
+    {
+        FItemContainerSnapshotReader Reader(Bytes);
+        OutStore.Init(Reader.GetSlotCount());
+
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure Item;
+        int32 NumRecords = 0;
+        while (Reader.Next(SlotIndex, Item))
+        {
+            if (!Test.TestTrue(TEXT("Record slot is inside the snapshot"), OutStore.IsValidIndex(SlotIndex)))
+            {
+                return false;
+            }
+            OutStore.Set(SlotIndex, Item);
+            ++NumRecords;
+        }
+
+        return Test.TestFalse(TEXT("Snapshot read without error"), Reader.HasError())
+            && Test.TestEqual(TEXT("Every record was read"), NumRecords, Reader.GetRecordCount());
+    }
+
+    /** Compares two stores slot by slot, empty slots included */
+    static bool TestStoresEqual(FAutomationTestBase& Test, const FItemSlotStore& Expected, const FItemSlotStore& Actual)
+    {
+        if (!Test.TestEqual(TEXT("Slot count"), Actual.Num(), Expected.Num()))
+        {
+            return false;
+        }
+
+        for (int32 SlotIndex = 0; SlotIndex < Expected.Num(); ++SlotIndex)
+        {
+            const FItemStructure ExpectedItem = Expected.MakeItem(SlotIndex);
+            const FItemStructure ActualItem = Actual.MakeItem(SlotIndex);
+            const FString Slot = FString::Printf(TEXT("Slot %d"), SlotIndex);
+
+            // Empty slots have no record, so only their emptiness round-trips
+            if (ExpectedItem.IsEmpty())
+            {
+                if (!Test.TestTrue(*(Slot + TEXT(" is empty")), ActualItem.IsEmpty()))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            const bool bEqual = Test.TestEqual(*(Slot + TEXT(" key")), ActualItem.RegistryKey.ToString(), ExpectedItem.RegistryKey.ToString())
+                && Test.TestEqual(*(Slot + TEXT(" asset")), ActualItem.ItemAsset.ToString(), ExpectedItem.ItemAsset.ToString())
+                && Test.TestEqual(*(Slot + TEXT(" quantity")), ActualItem.ItemQuantity, ExpectedItem.ItemQuantity)
+                && Test.TestEqual(*(Slot + TEXT(" stack size")), ActualItem.StackSize, ExpectedItem.StackSize)
+                && Test.TestEqual(*(Slot + TEXT(" current HP")), ActualItem.CurrentHP, ExpectedItem.CurrentHP)
+                && Test.TestEqual(*(Slot + TEXT(" max HP")), ActualItem.MaxHP, ExpectedItem.MaxHP)
+                && Test.TestEqual(*(Slot + TEXT(" current ammo")), ActualItem.CurrentAmmo, ExpectedItem.CurrentAmmo)
+                && Test.TestEqual(*(Slot + TEXT(" max ammo")), ActualItem.MaxAmmo, ExpectedItem.MaxAmmo);
+            if (!bEqual)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static bool TestRoundTrip(FAutomationTestBase& Test, const FItemSlotStore& Store)
+    {
+        FItemSlotStore ReadBack;
+        return ReadStore(Test, WriteStore(Store), ReadBack) && TestStoresEqual(Test, Store, ReadBack);
+    }
+}
+
+//===========================================Round trips====================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemContainerSnapshotEmptyTest, "SurvivalGame.Inventory.Snapshot.Empty", ItemContainerSnapshotTests::TestFlags)
+
+bool FItemContainerSnapshotEmptyTest::RunTest(const FString& Parameters)
+{
+    using namespace ItemContainerSnapshotTests;
+
+    const FItemSlotStore Store = MakeStore(32, [](int32) { return FItemStructure(); });
+    const TArray<uint8> Bytes = WriteStore(Store);
+
+    FItemContainerSnapshotReader Reader(Bytes);
+    TestEqual(TEXT("Slot count"), Reader.GetSlotCount(), 32);
+    TestEqual(TEXT("Record count"), Reader.GetRecordCount(), 0);
+
+    return TestRoundTrip(*this, Store);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemContainerSnapshotFullTest, "SurvivalGame.Inventory.Snapshot.Full", ItemContainerSnapshotTests::TestFlags)
+
+bool FItemContainerSnapshotFullTest::RunTest(const FString& Parameters)
+{
+    using namespace ItemContainerSnapshotTests;
+
+    const FItemSlotStore Store = MakeStore(64, [](const int32 SlotIndex) { return MakeTestItem(SlotIndex); });
+    return TestRoundTrip(*this, Store);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemContainerSnapshotSparseTest, "SurvivalGame.Inventory.Snapshot.Sparse", ItemContainerSnapshotTests::TestFlags)
+
+bool FItemContainerSnapshotSparseTest::RunTest(const FString& Parameters)
+{
+    using namespace ItemContainerSnapshotTests;
+
+    // First, last and a long gap in between; slot indices are stored as gaps
+    const FItemSlotStore Store = MakeStore(1000, [](const int32 SlotIndex)
+    {
+        return SlotIndex == 0 || SlotIndex == 1 || SlotIndex == 500 || SlotIndex == 999 ? MakeTestItem(SlotIndex) : FItemStructure();
+    });
+    return TestRoundTrip(*this, Store);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemContainerSnapshotMaxQuantityTest, "SurvivalGame.Inventory.Snapshot.MaxQuantity", ItemContainerSnapshotTests::TestFlags)
+
+bool FItemContainerSnapshotMaxQuantityTest::RunTest(const FString& Parameters)
+{
+    using namespace ItemContainerSnapshotTests;
+
+    // Extremes of every optional field, including the negative ends of the zigzag encoding
+    const FItemSlotStore Store = MakeStore(4, [](const int32 SlotIndex)
+    {
+        FItemStructure Item = MakeTestItem(SlotIndex);
+        Item.StackSize = MAX_int32;
+        Item.ItemQuantity = SlotIndex % 2 == 0 ? MAX_int32 : 1;
+        Item.CurrentAmmo = SlotIndex % 2 == 0 ? MAX_int32 : MIN_int32;
+        Item.MaxAmmo = MAX_int32;
+        Item.CurrentHP = SlotIndex % 2 == 0 ? TNumericLimits<float>::Max() : TNumericLimits<float>::Lowest();
+        Item.MaxHP = TNumericLimits<float>::Max();
+        return Item;
+    });
+    return TestRoundTrip(*this, Store);
+}
+
+//===========================================Malformed input====================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemContainerSnapshotVersionTest, "SurvivalGame.Inventory.Snapshot.UnknownVersion", ItemContainerSnapshotTests::TestFlags)
+
+bool FItemContainerSnapshotVersionTest::RunTest(const FString& Parameters)
+{
+    using namespace ItemContainerSnapshotTests;
+
+    const FItemSlotStore Store = MakeStore(8, [](const int32 SlotIndex) { return MakeTestItem(SlotIndex); });
+    const TArray<uint8> Bytes = WriteStore(Store);
+
+    // A newer writer that only appended fields stays readable
+    {
+        TArray<uint8> Newer = Bytes;
+        Newer[SchemaVersionOffset] = FItemContainerSnapshot::SchemaVersion + 1;
+
+        FItemSlotStore ReadBack;
+        TestTrue(TEXT("Newer additive version reads"), ReadStore(*this, Newer, ReadBack) && TestStoresEqual(*this, Store, ReadBack));
+    }
+
+    // One that needs a newer reader is refused
+    {
+        AddExpectedMessage(TEXT("snapshot needs a newer reader"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1, false);
+
+        TArray<uint8> Incompatible = Bytes;
+        Incompatible[MinReaderVersionOffset] = FItemContainerSnapshot::SchemaVersion + 1;
+
+        FItemContainerSnapshotReader Reader(Incompatible);
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure Item;
+        TestFalse(TEXT("Incompatible version yields no records"), Reader.Next(SlotIndex, Item));
+        TestTrue(TEXT("Incompatible version is an error"), Reader.HasError());
+    }
+
+    // Versions older than the oldest readable one have no upgrade path
+    {
+        AddExpectedError(TEXT("is older than the oldest readable version"), EAutomationExpectedErrorFlags::Contains, 1, false);
+
+        TArray<uint8> Older = Bytes;
+        Older[SchemaVersionOffset] = FItemContainerSnapshot::OldestReadableVersion - 1;
+
+        FItemContainerSnapshotReader Reader(Older);
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure Item;
+        TestFalse(TEXT("Older version yields no records"), Reader.Next(SlotIndex, Item));
+        TestTrue(TEXT("Older version is an error"), Reader.HasError());
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemContainerSnapshotTruncatedTest, "SurvivalGame.Inventory.Snapshot.Truncated", ItemContainerSnapshotTests::TestFlags)
+
+bool FItemContainerSnapshotTruncatedTest::RunTest(const FString& Parameters)
+{
+    using namespace ItemContainerSnapshotTests;
+
+    const FItemSlotStore Store = MakeStore(16, [](const int32 SlotIndex) { return SlotIndex % 3 == 0 ? MakeTestItem(SlotIndex) : FItemStructure(); });
+    const TArray<uint8> Bytes = WriteStore(Store);
+
+    // Every cut-off point fails cleanly instead of reading past the buffer
+    AddExpectedMessage(TEXT("FItemContainerSnapshotReader: Malformed snapshot"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, Bytes.Num(), false);
+
+    for (int32 Length = 0; Length < Bytes.Num(); ++Length)
+    {
+        FItemContainerSnapshotReader Reader(TConstArrayView<uint8>(Bytes.GetData(), Length));
+
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure Item;
+        while (Reader.Next(SlotIndex, Item))
+        {
+            if (!TestTrue(TEXT("Records stay inside the snapshot"), SlotIndex >= 0 && SlotIndex < Store.Num()))
+            {
+                return false;
+            }
+        }
+
+        if (!TestTrue(*FString::Printf(TEXT("Snapshot cut to %d of %d bytes is an error"), Length, Bytes.Num()), Reader.HasError()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemContainerSnapshotHugeCountTest, "SurvivalGame.Inventory.Snapshot.HugeCount", ItemContainerSnapshotTests::TestFlags)
+
+bool FItemContainerSnapshotHugeCountTest::RunTest(const FString& Parameters)
+{
+    using namespace ItemContainerSnapshotTests;
+
+    // Counts near MAX_int32 in an otherwise tiny snapshot must fail before anything is reserved
+    AddExpectedMessage(TEXT("id count larger than the buffer"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1, false);
+    AddExpectedMessage(TEXT("record count larger than the buffer"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1, false);
+
+    constexpr uint8 HugeCount[] = { 0xFE, 0xFF, 0xFF, 0xFF, 0x07 }; // MAX_int32 - 1
+
+    const auto MakeHeader = [&HugeCount](const bool bHugeIds)
+    {
+        TArray<uint8> Bytes;
+        for (int32 Shift = 0; Shift < 32; Shift += 8)
+        {
+            Bytes.Add(static_cast<uint8>(FItemContainerSnapshot::Magic >> Shift));
+        }
+        Bytes.Add(FItemContainerSnapshot::SchemaVersion);
+        Bytes.Add(FItemContainerSnapshot::SchemaVersion);
+        Bytes.Add(0); // ExtraHeaderBytes
+        Bytes.Add(8); // SlotCount
+
+        // Either the id count or, after an empty id table, the record count
+        if (!bHugeIds)
+        {
+            Bytes.Add(0);
+        }
+        Bytes.Append(HugeCount, UE_ARRAY_COUNT(HugeCount));
+        Bytes.AddZeroed(16);
+        return Bytes;
+    };
+
+    for (const bool bHugeIds : { true, false })
+    {
+        FItemContainerSnapshotReader Reader(MakeHeader(bHugeIds));
+
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure Item;
+        TestFalse(bHugeIds ? TEXT("Huge id count yields no records") : TEXT("Huge record count yields no records"), Reader.Next(SlotIndex, Item));
+        TestTrue(bHugeIds ? TEXT("Huge id count is an error") : TEXT("Huge record count is an error"), Reader.HasError());
+    }
+
+    return true;
+}
+
+//===========================================Throughput====================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemContainerSnapshotThroughputTest, "SurvivalGame.Inventory.Snapshot.Throughput",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FItemContainerSnapshotThroughputTest::RunTest(const FString& Parameters)
+{
+    using namespace ItemContainerSnapshotTests;
+
+    constexpr int32 NumSlots = 1024;
+    constexpr int32 Iterations = 200;
+
+    const FItemSlotStore Store = MakeStore(NumSlots, [](const int32 SlotIndex) { return MakeTestItem(SlotIndex); });
+
+    TArray<uint8> Bytes;
+    const double WriteStart = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        Bytes.Reset();
+        FItemContainerSnapshot::Write(Store, 0, NumSlots, Bytes);
+    }
+    const double WriteSeconds = FPlatformTime::Seconds() - WriteStart;
+
+    int64 RecordsRead = 0;
+    const double ReadStart = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        FItemContainerSnapshotReader Reader(Bytes);
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure Item;
+        while (Reader.Next(SlotIndex, Item))
+        {
+            ++RecordsRead;
+        }
+
+        if (!TestFalse(TEXT("Snapshot read without error"), Reader.HasError()))
+        {
+            return false;
+        }
+    }
+    const double ReadSeconds = FPlatformTime::Seconds() - ReadStart;
+
+    TestEqual(TEXT("Every record was read on every pass"), RecordsRead, static_cast<int64>(NumSlots) * Iterations);
+
+    const double MegaBytes = static_cast<double>(Bytes.Num()) * Iterations / (1024.0 * 1024.0);
+    AddInfo(FString::Printf(TEXT("%d slots, %d bytes per snapshot"), NumSlots, Bytes.Num()));
+    AddInfo(FString::Printf(TEXT("Write: %.1f MB/s, %.0f ns/slot"), MegaBytes / FMath::Max(WriteSeconds, UE_DOUBLE_SMALL_NUMBER),
+        WriteSeconds * 1.0e9 / (static_cast<double>(NumSlots) * Iterations)));
+    AddInfo(FString::Printf(TEXT("Read: %.1f MB/s, %.0f ns/slot"), MegaBytes / FMath::Max(ReadSeconds, UE_DOUBLE_SMALL_NUMBER),
+        ReadSeconds * 1.0e9 / (static_cast<double>(NumSlots) * Iterations)));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,122 @@
+// StorageSubsystemTests.cpp
+
+#include "Components/Inventory/Child/StorageContainer.h"
+#include "Components/Inventory/ItemContainerSnapshot.h"
+#include "Components/Inventory/ItemSlotStore.h"
+#include "Core/StorageSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace StorageSubsystemTests
+{
+    constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+    /** Item outside the item index, carrying its own asset path */
+    static FItemStructure MakeTestItem(const int32 Quantity)
+    {
+        FItemStructure Item;
+        Item.RegistryKey = TEXT("StorageTestItem");
+        Item.ItemAsset = TSoftObjectPtr<UItemInfo>(FSoftObjectPath(TEXT("/Game/Tests/StorageTestItem.StorageTestItem")));
+        Item.StackSize = 10;
+        Item.ItemQuantity = Quantity;
+        return Item;
+    }
+
+    static TArray<uint8> MakeSnapshot(const int32 NumSlots)
+    {
+        FItemSlotStore Store;
+        Store.Init(NumSlots);
+        for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+        {
+            Store.Set(SlotIndex, MakeTestItem(1 + SlotIndex % 10));
+        }
+
+        TArray<uint8> Bytes;
+        FItemContainerSnapshot::Write(Store, 0, NumSlots, Bytes);
+        return Bytes;
+    }
+}
+
+//===========================================Restore failure====================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStorageSubsystemRestoreFailureTest, "SurvivalGame.Inventory.Storage.RestoreFailure", StorageSubsystemTests::TestFlags)
+
+bool FStorageSubsystemRestoreFailureTest::RunTest(const FString& Parameters)
+{
+    using namespace StorageSubsystemTests;
+
+    struct FCase
+    {
+        const TCHAR* Name;
+        TArray<uint8> Bytes;
+        int32 MaxSlots;
+    };
+
+    // A snapshot cut off mid-record, and a good one with more slots than the chest has now
+    TArray<FCase> Cases;
+    {
+        TArray<uint8> Truncated = MakeSnapshot(8);
+        Truncated.SetNum(Truncated.Num() - 3);
+        Cases.Add({ TEXT("Corrupt"), MoveTemp(Truncated), 8 });
+        Cases.Add({ TEXT("Oversized"), MakeSnapshot(8), 4 });
+    }
+
+    AddExpectedError(TEXT("leaving it paged out"), EAutomationExpectedErrorFlags::Contains, Cases.Num());
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+
+    UStorageSubsystem* Storage = World->GetSubsystem<UStorageSubsystem>();
+    if (!TestNotNull(TEXT("Storage subsystem"), Storage))
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    TArray<FString> Paths;
+    for (FCase& Case : Cases)
+    {
+        AActor* Chest = World->SpawnActor<AActor>();
+        UStorageContainer* Container = NewObject<UStorageContainer>(Chest);
+        Container->MaxSlots = Case.MaxSlots;
+        Container->StorageId = FGuid::NewGuid();
+        Container->RegisterComponent();
+
+        const FString& Path = Paths.Add_GetRef(UStorageSubsystem::GetStoragePath(Container->StorageId));
+        TestTrue(*FString::Printf(TEXT("%s: snapshot written"), Case.Name), FFileHelper::SaveArrayToFile(Case.Bytes, *Path));
+
+        Storage->RegisterStorage(Container);
+        TestFalse(*FString::Printf(TEXT("%s: acquire fails"), Case.Name), Storage->AcquireStorage(Container));
+        TestFalse(*FString::Printf(TEXT("%s: chest stays paged out"), Case.Name), Container->IsResident());
+
+        // Writes go through the same page-in and must not land in an empty stand-in
+        TestFalse(*FString::Printf(TEXT("%s: writes are refused"), Case.Name), Container->AddItem(MakeTestItem(1)));
+        TestFalse(*FString::Printf(TEXT("%s: a second acquire fails too"), Case.Name), Container->EnsureResident());
+
+        Storage->UnregisterStorage(Container);
+    }
+
+    // Shutdown writes out everything that changed
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+
+    for (int32 CaseIndex = 0; CaseIndex < Cases.Num(); ++CaseIndex)
+    {
+        TArray<uint8> OnDisk;
+        TestTrue(*FString::Printf(TEXT("%s: file still there"), Cases[CaseIndex].Name), FFileHelper::LoadFileToArray(OnDisk, *Paths[CaseIndex]));
+        TestTrue(*FString::Printf(TEXT("%s: file untouched"), Cases[CaseIndex].Name), OnDisk == Cases[CaseIndex].Bytes);
+
+        IFileManager::Get().Delete(*Paths[CaseIndex], false, false, true);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
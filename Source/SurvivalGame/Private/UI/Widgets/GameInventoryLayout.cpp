@@ -1,4 +1,5 @@
 #include "UI/Widgets/GameInventoryLayout.h"
+#include "Core/SurvivalLog.h"
 #include "CommonButtonBase.h"
 #include "SurvivalPlayerController.h"
 #include "Interfaces/ControllerInterface.h"
@@ -7,14 +8,14 @@
 UGameInventoryLayout::UGameInventoryLayout(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
-    UE_LOG(LogTemp, Log, TEXT("GameInventoryLayout Constructor"));
+    UE_LOG(LogInventoryUI, Verbose, TEXT("GameInventoryLayout Constructor"));
 }
 
 void UGameInventoryLayout::NativeConstruct()
 {
     Super::NativeConstruct();
 
-    UE_LOG(LogTemp, Log, TEXT("GameInventoryLayout::NativeConstruct"));
+    UE_LOG(LogInventoryUI, Verbose, TEXT("GameInventoryLayout::NativeConstruct"));
 
     // Cache the owning player controller for later use
     CachedPlayerController = Cast<APlayerController>(GetOwningPlayer());
@@ -38,16 +39,16 @@ void UGameInventoryLayout::NativeConstruct()
             if (InventoryContainer)
             {
                 InventoryContainer->PrintInventoryContents();
-                UE_LOG(LogTemp, Log, TEXT("Printed inventory contents for debugging"));
+                UE_LOG(LogInventoryUI, Log, TEXT("Printed inventory contents for debugging"));
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("Could not find inventory container component"));
+                UE_LOG(LogInventoryUI, Warning, TEXT("Could not find inventory container component"));
             }
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("Could not get owning player pawn"));
+            UE_LOG(LogInventoryUI, Warning, TEXT("Could not get owning player pawn"));
         }
     }
 } 
@@ -71,6 +72,6 @@ void UGameInventoryLayout::NativeOnDeactivated()
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("NativeOnDeactivated: No valid PlayerController to close inventory."));
+        UE_LOG(LogInventoryUI, Warning, TEXT("NativeOnDeactivated: No valid PlayerController to close inventory."));
     }
 }
\ No newline at end of file
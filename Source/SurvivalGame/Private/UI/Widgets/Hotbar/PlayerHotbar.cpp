@@ -1,4 +1,5 @@
 #include "UI/Widgets/Hotbar/PlayerHotbar.h"
+#include "Core/SurvivalLog.h"
 #include "Components/Border.h"
 #include "UI/Widgets/Inventory/ItemContainerGrid.h"
 #include "CommonUI/Public/CommonActionWidget.h"
@@ -25,7 +26,7 @@ void UPlayerHotbar::NativeConstruct()
     // Validate essential widget references are bound correctly
     if (!ValidateWidgetReferences())
     {
-        UE_LOG(LogTemp, Error, TEXT("UPlayerHotbar: Failed to validate widget references. Check UMG bindings."));
+        UE_LOG(LogInventoryUI, Error, TEXT("UPlayerHotbar: Failed to validate widget references. Check UMG bindings."));
         return;
     }
     
@@ -53,7 +54,7 @@ bool UPlayerHotbar::ValidateWidgetReferences() const
     
     if (!ItemContainerGrid)
     {
-        UE_LOG(LogTemp, Error, TEXT("%s: ItemContainerGrid not found! Make sure it's bound in the Blueprint."), *GetName());
+        UE_LOG(LogInventoryUI, Error, TEXT("%s: ItemContainerGrid not found! Make sure it's bound in the Blueprint."), *GetName());
         bIsValid = false;
     }
     
@@ -61,7 +62,7 @@ bool UPlayerHotbar::ValidateWidgetReferences() const
     if (!Hotbar01 || !Hotbar02 || !Hotbar03 || !Hotbar04 ||
         !Hotbar05 || !Hotbar06 || !Hotbar07 || !Hotbar08)
     {
-        UE_LOG(LogTemp, Error, TEXT("%s: One or more hotbar slot widgets not found! Check UMG bindings."), *GetName());
+        UE_LOG(LogInventoryUI, Error, TEXT("%s: One or more hotbar slot widgets not found! Check UMG bindings."), *GetName());
         bIsValid = false;
     }
     
@@ -73,7 +74,7 @@ void UPlayerHotbar::SetActiveHotbarSlot(int32 SlotIndex)
     // Validate slot index
     if (SlotIndex < 0 || SlotIndex >= HotbarSlotCount)
     {
-        UE_LOG(LogTemp, Warning, TEXT("UPlayerHotbar::SetActiveHotbarSlot: Invalid slot index %d"), SlotIndex);
+        UE_LOG(LogInventoryUI, Warning, TEXT("UPlayerHotbar::SetActiveHotbarSlot: Invalid slot index %d"), SlotIndex);
         return;
     }
     
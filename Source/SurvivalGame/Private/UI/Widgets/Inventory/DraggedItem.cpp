@@ -1,4 +1,5 @@
 #include "UI/Widgets/Inventory/DraggedItem.h"
+#include "Core/SurvivalLog.h"
 #include "Components/TextBlock.h"
 #include "Components/ProgressBar.h"
 
@@ -24,27 +25,27 @@ void UDraggedItem::NativePreConstruct()
     // Validate widget bindings with specific errors
     if (!ItemWeight)
     {
-        UE_LOG(LogTemp, Error, TEXT("DraggedItem: ItemWeight binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("DraggedItem: ItemWeight binding is missing!"));
     }
     if (!ItemIcon)
     {
-        UE_LOG(LogTemp, Error, TEXT("DraggedItem: ItemIcon binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("DraggedItem: ItemIcon binding is missing!"));
     }
     if (!ItemQuantity)
     {
-        UE_LOG(LogTemp, Error, TEXT("DraggedItem: ItemQuantity binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("DraggedItem: ItemQuantity binding is missing!"));
     }
     if (!TopText)
     {
-        UE_LOG(LogTemp, Error, TEXT("DraggedItem: TopText binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("DraggedItem: TopText binding is missing!"));
     }
     if (!BottomTextAmmo)
     {
-        UE_LOG(LogTemp, Error, TEXT("DraggedItem: BottomTextAmmo binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("DraggedItem: BottomTextAmmo binding is missing!"));
     }
     if (!ItemHPBar)
     {
-        UE_LOG(LogTemp, Error, TEXT("DraggedItem: ItemHPBar binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("DraggedItem: ItemHPBar binding is missing!"));
     }
     
     // Apply the settings from the exposed properties
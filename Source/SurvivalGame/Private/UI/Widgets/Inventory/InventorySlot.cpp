@@ -1,8 +1,9 @@
 #include "UI/Widgets/Inventory/InventorySlot.h"
+#include "Core/SurvivalLog.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Engine/StreamableManager.h"
-#include "Engine/AssetManager.h"
+#include "Core/SurvivalAssetManager.h"
 #include "Data/PrimaryData/ItemInfo.h"  
 #include "Components/TextBlock.h"
 #include "Components/ProgressBar.h"
@@ -46,27 +47,27 @@ void UInventorySlot::NativePreConstruct()
     // Validate widget bindings with specific errors
     if (!ItemWeight)
     {
-        UE_LOG(LogTemp, Error, TEXT("InventorySlot: ItemWeight binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("InventorySlot: ItemWeight binding is missing!"));
     }
     if (!ItemIcon)
     {
-        UE_LOG(LogTemp, Error, TEXT("InventorySlot: ItemIcon binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("InventorySlot: ItemIcon binding is missing!"));
     }
     if (!ItemQuantity)
     {
-        UE_LOG(LogTemp, Error, TEXT("InventorySlot: ItemQuantity binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("InventorySlot: ItemQuantity binding is missing!"));
     }
     if (!TopText)
     {
-        UE_LOG(LogTemp, Error, TEXT("InventorySlot: TopText binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("InventorySlot: TopText binding is missing!"));
     }
     if (!BottomTextAmmo)
     {
-        UE_LOG(LogTemp, Error, TEXT("InventorySlot: BottomTextAmmo binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("InventorySlot: BottomTextAmmo binding is missing!"));
     }
     if (!ItemHPBar)
     {
-        UE_LOG(LogTemp, Error, TEXT("InventorySlot: ItemHPBar binding is missing!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("InventorySlot: ItemHPBar binding is missing!"));
     }
 }
 
@@ -143,7 +144,7 @@ void UInventorySlot::NativeOnDragDetected(const FGeometry& InGeometry, const FPo
     UDraggedItem* DragVisual = CreateWidget<UDraggedItem>(GetOwningPlayer(), DraggedItemClass);
     if (!DragVisual)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create DraggedItem widget"));
+        UE_LOG(LogInventoryUI, Error, TEXT("Failed to create DraggedItem widget"));
         return;
     }
     
@@ -196,7 +197,7 @@ void UInventorySlot::NativeOnDragDetected(const FGeometry& InGeometry, const FPo
     UItemDrag* DragOperation = NewObject<UItemDrag>();
     if (!DragOperation)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create ItemDrag operation"));
+        UE_LOG(LogInventoryUI, Error, TEXT("Failed to create ItemDrag operation"));
         return;
     }
     
@@ -235,7 +236,7 @@ bool UInventorySlot::NativeOnDrop(const FGeometry& MyGeometry, const FDragDropEv
     APawn* PlayerCharacter = GetOwningPlayerPawn();
     if (!IsValid(PlayerCharacter))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to get valid Player Character in InventorySlot::NativeOnDrop"));
+        UE_LOG(LogInventoryUI, Error, TEXT("Failed to get valid Player Character in InventorySlot::NativeOnDrop"));
         return false;
     }
 
@@ -268,14 +269,12 @@ void UInventorySlot::OnItemAssetLoaded()
     if (StoredItemInfo.ItemAsset.IsNull() && !StoredItemInfo.RegistryKey.IsNone())
     {
         // Try to resolve the asset using the registry key if the path is still missing
-        UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
-        if (AssetManager)
+        if (const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid())
         {
-            FPrimaryAssetId ItemId = FPrimaryAssetId(FPrimaryAssetType("Item"), StoredItemInfo.RegistryKey);
-            FSoftObjectPath ItemPath = AssetManager->GetPrimaryAssetPath(ItemId);
+            const FSoftObjectPath ItemPath = AssetManager->FindItemAssetPath(StoredItemInfo.RegistryKey);
             if (!ItemPath.IsNull())
             {
-                UE_LOG(LogTemp, Log, TEXT("OnItemAssetLoaded: Fixed missing asset reference for slot %d"), ItemIndex);
+                UE_LOG(LogInventoryUI, Verbose, TEXT("OnItemAssetLoaded: Fixed missing asset reference for slot %d"), ItemIndex);
                 StoredItemInfo.ItemAsset = TSoftObjectPtr<UItemInfo>(ItemPath);
             }
         }
@@ -291,24 +290,24 @@ void UInventorySlot::OnItemAssetLoaded()
             ItemAssetInfo = Cast<UItemInfo>(SoftItemAsset.Get());
             if (ItemAssetInfo)
             {
-                UE_LOG(LogTemp, Log, TEXT("OnItemAssetLoaded: Slot %d loaded item %s successfully"), 
+                UE_LOG(LogInventoryUI, Verbose, TEXT("OnItemAssetLoaded: Slot %d loaded item %s successfully"), 
                     ItemIndex, *ItemAssetInfo->GetName());
                 // Now update the UI elements
                 UpdateUIElements();
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("OnItemAssetLoaded: Failed to cast to UItemInfo for slot %d"), ItemIndex);
+                SURVIVAL_LOG_RATELIMITED(LogInventoryUI, Error, 1.0, TEXT("OnItemAssetLoaded: Failed to cast to UItemInfo for slot %d"), ItemIndex);
             }
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("OnItemAssetLoaded: Asset still not valid after load attempt for slot %d"), ItemIndex);
+            SURVIVAL_LOG_RATELIMITED(LogInventoryUI, Warning, 1.0, TEXT("OnItemAssetLoaded: Asset still not valid after load attempt for slot %d"), ItemIndex);
         }
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("OnItemAssetLoaded: No asset path available for slot %d"), ItemIndex);
+        SURVIVAL_LOG_RATELIMITED(LogInventoryUI, Error, 1.0, TEXT("OnItemAssetLoaded: No asset path available for slot %d"), ItemIndex);
     }
 }
 
@@ -323,7 +322,7 @@ void UInventorySlot::UpdateUIElements() const
     // If our asset still isn't loaded, bail out.
     if (!ItemAssetInfo)
     {
-        UE_LOG(LogTemp, Warning, TEXT("UpdateUIElements: ItemAssetInfo is null. Aborting UI update."));
+        SURVIVAL_LOG_RATELIMITED(LogInventoryUI, Warning, 1.0, TEXT("UpdateUIElements: ItemAssetInfo is null. Aborting UI update."));
         return;
     }
 
@@ -361,7 +360,7 @@ void UInventorySlot::UpdateUIElements() const
             ItemIcon->SetBrush(Brush);
             ItemIcon->SetVisibility(ESlateVisibility::Visible);
             
-            UE_LOG(LogTemp, Verbose, TEXT("UpdateUIElements: Using cached icon texture"));
+            UE_LOG(LogInventoryUI, Verbose, TEXT("UpdateUIElements: Using cached icon texture"));
         }
         else
         {
@@ -510,14 +509,14 @@ void UInventorySlot::UpdateSlot(FItemStructure ItemInfo)
     FString* ExistingKey = LastUpdateKeys.Find(ItemIndex);
     if (ExistingKey && *ExistingKey == UpdateKey && bHasItemInSlot)
     {
-        UE_LOG(LogTemp, Verbose, TEXT("UpdateSlot: Skipping duplicate update for slot %d"), ItemIndex);
+        UE_LOG(LogInventoryUI, Verbose, TEXT("UpdateSlot: Skipping duplicate update for slot %d"), ItemIndex);
         return;
     }
     
     // Record this update
     LastUpdateKeys.FindOrAdd(ItemIndex) = UpdateKey;
     
-    UE_LOG(LogTemp, Log, TEXT("UpdateSlot: Starting for slot %d"), ItemIndex);
+    UE_LOG(LogInventoryUI, Verbose, TEXT("UpdateSlot: Starting for slot %d"), ItemIndex);
     
     // Step 1: Mark this slot as occupied
     bHasItemInSlot = true;
@@ -528,7 +527,7 @@ void UInventorySlot::UpdateSlot(FItemStructure ItemInfo)
     // Skip if registry key is invalid
     if (ItemInfo.RegistryKey.IsNone())
     {
-        UE_LOG(LogTemp, Verbose, TEXT("UpdateSlot: Empty item received for slot %d, clearing"), ItemIndex);
+        UE_LOG(LogInventoryUI, Verbose, TEXT("UpdateSlot: Empty item received for slot %d, clearing"), ItemIndex);
         ClearSlot();
         return;
     }
@@ -538,12 +537,10 @@ void UInventorySlot::UpdateSlot(FItemStructure ItemInfo)
     
     if (AssetPath.IsNull())
     {
-        // Try to resolve via asset manager if path is missing
-        UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
-        if (AssetManager)
+        // Try to resolve via the item index if path is missing
+        if (const USurvivalAssetManager* AssetManager = USurvivalAssetManager::GetIfValid())
         {
-            FPrimaryAssetId ItemId = FPrimaryAssetId(FPrimaryAssetType("Item"), ItemInfo.RegistryKey);
-            FSoftObjectPath ItemPath = AssetManager->GetPrimaryAssetPath(ItemId);
+            const FSoftObjectPath ItemPath = AssetManager->FindItemAssetPath(ItemInfo.RegistryKey);
             
             if (!ItemPath.IsNull())
             {
@@ -552,7 +549,7 @@ void UInventorySlot::UpdateSlot(FItemStructure ItemInfo)
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("UpdateSlot: Failed to resolve asset path for registry key: %s"), 
+                SURVIVAL_LOG_RATELIMITED(LogInventoryUI, Error, 1.0, TEXT("UpdateSlot: Failed to resolve asset path for registry key: %s"), 
                        *ItemInfo.RegistryKey.ToString());
                 ClearSlot();
                 return;
@@ -560,13 +557,13 @@ void UInventorySlot::UpdateSlot(FItemStructure ItemInfo)
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("UpdateSlot: Attempting to load asset at path: %s"), *AssetPath.ToString());
+    UE_LOG(LogInventoryUI, Verbose, TEXT("UpdateSlot: Attempting to load asset at path: %s"), *AssetPath.ToString());
     
     // Check if we already have this asset loaded via cache
     UItemInfo* CachedInfo = Cast<UItemInfo>(AssetPath.ResolveObject());
     if (CachedInfo)
     {
-        UE_LOG(LogTemp, Log, TEXT("UpdateSlot: Using already loaded asset: %s"), *CachedInfo->GetName());
+        UE_LOG(LogInventoryUI, Verbose, TEXT("UpdateSlot: Using already loaded asset: %s"), *CachedInfo->GetName());
         ItemAssetInfo = CachedInfo;
         UpdateUIElements();
         return;
@@ -576,7 +573,7 @@ void UInventorySlot::UpdateSlot(FItemStructure ItemInfo)
     UItemInfo* GlobalCachedInfo = UItemAssetCache::GetCachedItemInfo(AssetPath);
     if (GlobalCachedInfo)
     {
-        UE_LOG(LogTemp, Log, TEXT("UpdateSlot: Using cached item info from global cache: %s"), *GlobalCachedInfo->GetName());
+        UE_LOG(LogInventoryUI, Verbose, TEXT("UpdateSlot: Using cached item info from global cache: %s"), *GlobalCachedInfo->GetName());
         ItemAssetInfo = GlobalCachedInfo;
         UpdateUIElements();
         return;
@@ -592,7 +589,7 @@ void UInventorySlot::UpdateSlot(FItemStructure ItemInfo)
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("UpdateSlot: Failed to load item info for slot %d"), ItemIndex);
+                SURVIVAL_LOG_RATELIMITED(LogInventoryUI, Error, 1.0, TEXT("UpdateSlot: Failed to load item info for slot %d"), ItemIndex);
             }
         })
     );
@@ -670,7 +667,7 @@ void UInventorySlot::ClearSlot()
     
     // Disable detailed logging in shipping builds
 #if !UE_BUILD_SHIPPING
-    UE_LOG(LogTemp, Verbose, TEXT("ClearSlot: Cleared slot %d"), ItemIndex);
+    UE_LOG(LogInventoryUI, Verbose, TEXT("ClearSlot: Cleared slot %d"), ItemIndex);
 #endif
 }
 
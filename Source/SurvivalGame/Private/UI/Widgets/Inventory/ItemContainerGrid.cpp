@@ -1,4 +1,5 @@
 #include "UI/Widgets/Inventory/ItemContainerGrid.h"
+#include "Core/SurvivalLog.h"
 #include "UI/Widgets/Inventory/InventorySlot.h"
 #include "Components/UniformGridPanel.h"
 #include "Components/UniformGridSlot.h"
@@ -20,33 +21,33 @@ void UItemContainerGrid::NativeConstruct()
 
     if (SlotsPerRow <= 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("SlotsPerRow is zero or negative, using default value of 6"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("SlotsPerRow is zero or negative, using default value of 6"));
         SlotsPerRow = 6;
     }
     
     if (TotalSlots <= 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("TotalSlots is zero or negative, using default value of 60"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("TotalSlots is zero or negative, using default value of 60"));
         TotalSlots = 60;
     }
     
     // Rest of your existing code
-    UE_LOG(LogTemp, Log, TEXT("ItemContainerGrid::NativeConstruct - Grid: %s, SlotClass: %s"), 
+    UE_LOG(LogInventoryUI, Log, TEXT("ItemContainerGrid::NativeConstruct - Grid: %s, SlotClass: %s"), 
         Grid ? TEXT("Valid") : TEXT("Invalid"),
         InventorySlotClass ? TEXT("Valid") : TEXT("Invalid"));
 
     // Add debug logging
-    UE_LOG(LogTemp, Log, TEXT("ItemContainerGrid::NativeConstruct - Grid: %s, SlotClass: %s"), 
+    UE_LOG(LogInventoryUI, Log, TEXT("ItemContainerGrid::NativeConstruct - Grid: %s, SlotClass: %s"), 
         Grid ? TEXT("Valid") : TEXT("Invalid"),
         InventorySlotClass ? TEXT("Valid") : TEXT("Invalid"));
 
     if (!Grid)
     {
-        UE_LOG(LogTemp, Error, TEXT("Grid panel is not properly bound in UMG!"));
+        UE_LOG(LogInventoryUI, Error, TEXT("Grid panel is not properly bound in UMG!"));
         return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Creating %d inventory slots"), TotalSlots);
+    UE_LOG(LogInventoryUI, Log, TEXT("Creating %d inventory slots"), TotalSlots);
     AddSlots(TotalSlots);
 }
 
@@ -54,19 +55,19 @@ void UItemContainerGrid::AddSlotToGrid(int32 Index, UInventorySlot* NewSlot)
 {
     if (SlotsPerRow <= 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddSlotToGrid: SlotsPerRow is zero or negative, using default value of 6"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("AddSlotToGrid: SlotsPerRow is zero or negative, using default value of 6"));
         SlotsPerRow = 6;
     }
     
     if (!Grid)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddSlotToGrid: Grid panel is not bound!"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("AddSlotToGrid: Grid panel is not bound!"));
         return;
     }
     
     if (!NewSlot)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddSlotToGrid: NewSlot is null!"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("AddSlotToGrid: NewSlot is null!"));
         return;
     }
     
@@ -77,7 +78,7 @@ void UItemContainerGrid::AddSlotToGrid(int32 Index, UInventorySlot* NewSlot)
     UUniformGridSlot* GridSlot = Cast<UUniformGridSlot>(Grid->AddChildToUniformGrid(NewSlot));
     if (!GridSlot)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddSlotToGrid: Failed to add slot to grid."));
+        UE_LOG(LogInventoryUI, Warning, TEXT("AddSlotToGrid: Failed to add slot to grid."));
         return;
     }
     
@@ -99,14 +100,14 @@ void UItemContainerGrid::AddSlots(int32 Amount)
 {
     if (!InventorySlotClass)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddSlots: InventorySlotClass is not set!"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("AddSlots: InventorySlotClass is not set!"));
         return;
     }
     
     APlayerController* PC = GetOwningPlayer();
     if (!PC)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddSlots: No owning player found!"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("AddSlots: No owning player found!"));
         return;
     }
     
@@ -125,11 +126,11 @@ void UItemContainerGrid::AddSlots(int32 Amount)
             // Call AddSlotToGrid with adjusted index for visual layout
             AddSlotToGrid(i + 1, NewSlot);
             
-            UE_LOG(LogTemp, Log, TEXT("AddSlots: Created slot with index %d"), i);
+            UE_LOG(LogInventoryUI, Verbose, TEXT("AddSlots: Created slot with index %d"), i);
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("AddSlots: Failed to create an inventory slot widget."));
+            UE_LOG(LogInventoryUI, Warning, TEXT("AddSlots: Failed to create an inventory slot widget."));
         }
     }
 }
\ No newline at end of file
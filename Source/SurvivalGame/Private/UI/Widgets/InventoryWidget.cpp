@@ -1,5 +1,6 @@
 // InventoryWidget.cpp
 #include "UI/Widgets/InventoryWidget.h"
+#include "Core/SurvivalLog.h"
 
 UInventoryWidget::UInventoryWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -27,7 +28,7 @@ void UInventoryWidget::InitializeWidget()
 	if (ItemContainerGrid)
 	{
 		// Additional initialization can be added here
-		UE_LOG(LogTemp, Log, TEXT("ItemContainerGrid initialized in InventoryWidget"));
+		UE_LOG(LogInventoryUI, Log, TEXT("ItemContainerGrid initialized in InventoryWidget"));
 	}
 }
 
@@ -37,7 +38,7 @@ bool UInventoryWidget::ValidateWidgetReferences() const
 
 	if (!ItemContainerGrid)
 	{
-		UE_LOG(LogTemp, Error, TEXT("%s: ItemContainerGrid not found! Make sure it's bound in the Blueprint."), *GetName());
+		UE_LOG(LogInventoryUI, Error, TEXT("%s: ItemContainerGrid not found! Make sure it's bound in the Blueprint."), *GetName());
 		bIsValid = false;
 	}
 
@@ -1,4 +1,5 @@
 #include "UI/Widgets/MasterUILayout.h"
+#include "Core/SurvivalLog.h"
 #include "Widgets/CommonActivatableWidgetContainer.h"
 #include "UI/Widgets/GameInventoryLayout.h"
 #include "UI/Widgets/DefaultHUDLayout.h"
@@ -28,15 +29,15 @@ UDefaultHUDLayout* UMasterUILayout::PushDefaultHUDLayout()
 
 UGameInventoryLayout* UMasterUILayout::PushGameInventoryLayout()
 {
-    UE_LOG(LogTemp, Log, TEXT("PushGameInventoryLayout() Called."));
+    UE_LOG(LogInventoryUI, Log, TEXT("PushGameInventoryLayout() Called."));
     if (!ensure(GameInventoryStack))
     {
-        UE_LOG(LogTemp, Warning, TEXT("GameInventoryStack is nullptr!"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("GameInventoryStack is nullptr!"));
         return nullptr;
     }
     if (!ensure(GameInventoryLayoutClass))
     {
-        UE_LOG(LogTemp, Warning, TEXT("GameInventoryLayoutClass is nullptr! Did you set it in the BP?"));
+        UE_LOG(LogInventoryUI, Warning, TEXT("GameInventoryLayoutClass is nullptr! Did you set it in the BP?"));
         return nullptr;
     }
 
@@ -46,16 +47,16 @@ UGameInventoryLayout* UMasterUILayout::PushGameInventoryLayout()
         GameInventoryLayout = Cast<UGameInventoryLayout>(Widget);
         if (GameInventoryLayout)
         {
-            UE_LOG(LogTemp, Log, TEXT("PushGameInventoryLayout: Successfully created %s"), *GameInventoryLayout->GetName());
+            UE_LOG(LogInventoryUI, Log, TEXT("PushGameInventoryLayout: Successfully created %s"), *GameInventoryLayout->GetName());
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("PushGameInventoryLayout: Widget wasn't a UGameInventoryLayout!"));
+            UE_LOG(LogInventoryUI, Warning, TEXT("PushGameInventoryLayout: Widget wasn't a UGameInventoryLayout!"));
         }
         return GameInventoryLayout;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("PushGameInventoryLayout: AddWidget returned nullptr!"));
+    UE_LOG(LogInventoryUI, Warning, TEXT("PushGameInventoryLayout: AddWidget returned nullptr!"));
     return nullptr;
 }
 
@@ -39,7 +39,7 @@ public:
      * The socket name is specified as a FName and can correspond to predefined
      * sockets in the skeletal mesh of the character or structure to which the item is attached.
      */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "Equipable|Socket")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, BlueprintSetter = SetEquipableSocketName, Category = "Equipable|Socket")
     FName EquipableSocketName;
 
     /**
@@ -51,7 +51,7 @@ public:
      *
      * This property is editable in the editor and accessible in Blueprint scripts.
      */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "Equipable|AnimationState")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, BlueprintSetter = SetAnimationState, Category = "Equipable|AnimationState")
     E_EquipableAnimationStates AnimationState;
 
 
@@ -70,6 +70,19 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Replicated, Category="Equipable|TwoHanded", meta=(EditCondition="bIsTwoHanded", EditConditionHides))
     FName TwoHandedSocketName;
 
+    /**
+     * Setters for the replicated equip properties. The properties are push based, so every
+     * runtime write has to go through these to be sent.
+     */
+    UFUNCTION(BlueprintSetter)
+    void SetEquipableSocketName(FName NewSocketName);
+
+    UFUNCTION(BlueprintSetter)
+    void SetAnimationState(E_EquipableAnimationStates NewAnimationState);
+
+    /** Switches between one- and two-handed holding; TwoHandedSocketName is only used when two-handed */
+    void SetTwoHanded(bool bNewIsTwoHanded, FName NewTwoHandedSocketName);
+
     /**
      * Implements the logic to retrieve the equipable item's information,
      * including the socket name, animation state, and two-handed properties.
@@ -6,6 +6,7 @@
 #include "Characters/GameBaseCharacter.h"
 #include "Components/Inventory/Child/PlayerInventory.h"
 #include "Components/Inventory/Child/PlayerHotbarComponent.h" 
+#include "Components/Inventory/SlotMoveCommand.h"
 #include "GamePlayerCharacter.generated.h"
 
 UCLASS(Blueprintable, BlueprintType)
@@ -13,6 +14,9 @@ class SURVIVALGAME_API AGamePlayerCharacter : public AGameBaseCharacter
 {
     GENERATED_BODY()
 
+    /** The load-test commandlet sends move batches as a client would */
+    friend struct FInventoryLoadTestAccess;
+
 public:
     // Sets default values for this character's properties
     AGamePlayerCharacter();
@@ -41,27 +45,10 @@ protected:
                                          E_ContainerType FromContainerType,
                                          E_ArmorType ArmorType) override;
 
-    // Server RPC for slot drop operations
-    UFUNCTION(Server, Reliable, WithValidation)
-    void Server_SlotDrop(int32 DroppedIndex, 
-                        int32 FromIndex, 
-                        E_ContainerType TargetContainer, 
-                        E_ContainerType FromContainer,
-                        E_ArmorType ArmorType);
-    
-    bool Server_SlotDrop_Validate(int32 DroppedIndex, 
-                                int32 FromIndex, 
-                                E_ContainerType TargetContainer, 
-                                E_ContainerType FromContainer,
-                                E_ArmorType ArmorType);
-    
-    void Server_SlotDrop_Implementation(int32 DroppedIndex, 
-                                      int32 FromIndex, 
-                                      E_ContainerType TargetContainer, 
-                                      E_ContainerType FromContainer,
-                                      E_ArmorType ArmorType);
-
-    
+    /**
+     * Executes a slot drop on the server. Callable from the server only; clients go through
+     * OnSlotDrop so their moves are batched.
+     */
     UFUNCTION(BlueprintCallable)
     void ProcessSlotDrop(int32 DroppedIndex,
                          int32 FromIndex,
@@ -69,9 +56,56 @@ protected:
                          E_ContainerType FromContainer,
                          E_ArmorType ArmorType);
 
+    /**
+     * Queues a move. Owning clients predict it, then send everything queued during a frame in one
+     * Server_SubmitMoveCommands call; on the server it goes straight into the dispatcher queue.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void QueueMoveCommand(const FSlotMoveCommand& Command);
+
+    /** Delivers a frame's worth of moves; the server executes them in order from Tick and acks predicted ones */
+    UFUNCTION(Server, Reliable, WithValidation)
+    void Server_SubmitMoveCommands(const TArray<FSlotMoveCommand>& Commands);
+
+    /** Most commands sent in one batch; anything beyond waits for the next frame */
+    UPROPERTY(EditDefaultsOnly, Category = "Inventory|Moves", meta = (ClampMin = "1"))
+    int32 MaxMoveCommandsPerBatch = 64;
+
+    /** Most queued commands the server executes per tick; the rest carry over */
+    UPROPERTY(EditDefaultsOnly, Category = "Inventory|Moves", meta = (ClampMin = "1"))
+    int32 MaxMoveCommandsPerTick = 64;
+
+    /** Server-side backlog limit; batches that would exceed it are dropped */
+    UPROPERTY(EditDefaultsOnly, Category = "Inventory|Moves", meta = (ClampMin = "1"))
+    int32 MaxPendingMoveCommands = 256;
 
     virtual void ResetItem_Implementation(E_ContainerType Container, int32 Index) override;
 
+private:
+    /** Sends the client's queued moves, at most MaxMoveCommandsPerBatch per frame */
+    void FlushMoveCommands();
+
+    /** Validates and executes queued moves on the server, at most MaxMoveCommandsPerTick per call */
+    void DispatchMoveCommands();
+
+    /** Validates and executes one move. Server only. */
+    bool ExecuteMoveCommand(const FSlotMoveCommand& Command);
+
+    /** Whether a move only changes links of a linked-view hotbar */
+    bool IsLinkedHotbarMove(const FSlotMoveCommand& Command) const;
+
+    /** Reports a predicted command's outcome to the owning client */
+    void AcknowledgeMoveCommand(const FSlotMoveCommand& Command, bool bAccepted) const;
+
+    /** Resolves a container type against this player's own containers and the ones it has open */
+    UItemContainerBase* FindContainerByType(E_ContainerType ContainerType) const;
+
+    /** Client: moves waiting to be sent this frame */
+    TArray<FSlotMoveCommand> OutgoingMoveCommands;
+
+    /** Server: moves received and not yet executed, oldest first */
+    TArray<FSlotMoveCommand> PendingMoveCommands;
+
 
     
 };
\ No newline at end of file
@@ -30,4 +30,5 @@ public:
 
 	// PlayerInterface implementation
 	virtual void UpdateItem_Implementation(E_ContainerType ContainerType, int32 Index, FItemStructure ItemInfo) override;
+	virtual void UpdateItems_Implementation(E_ContainerType ContainerType, const TArray<FItemSlotUpdate>& SlotUpdates) override;
 };
\ No newline at end of file
@@ -4,13 +4,58 @@
 #include "Components/Inventory/ItemContainerBase.h"
 #include "PlayerHotbarComponent.generated.h"
 
+struct FSlotMoveCommand;
+
+/**
+ * @brief Reference from a linked hotbar slot to the container slot it shows.
+ *
+ * Packs into 2 or 3 bytes: one for the container type, a packed int for the slot.
+ */
+USTRUCT(BlueprintType)
+struct SURVIVALGAME_API FHotbarSlotLink
+{
+	GENERATED_BODY()
+
+	/** Container the slot belongs to; None leaves the hotbar slot empty */
+	UPROPERTY(BlueprintReadOnly, Category = "Hotbar")
+	E_ContainerType SourceContainer = E_ContainerType::None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Hotbar")
+	int32 SourceIndex = INDEX_NONE;
+
+	bool IsLinked() const { return SourceContainer != E_ContainerType::None && SourceIndex >= 0; }
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FHotbarSlotLink& Other) const
+	{
+		return SourceContainer == Other.SourceContainer && SourceIndex == Other.SourceIndex;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FHotbarSlotLink> : public TStructOpsTypeTraitsBase2<FHotbarSlotLink>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
 /**
  * @brief Component for managing player's hotbar items.
- * 
+ *
  * This component extends the base item container to specifically handle
  * quick-access items in the player's hotbar.
+ *
+ * With bLinkedView the hotbar holds no items of its own. Each slot references a slot of the
+ * owner's inventory and mirrors it, rebuilt locally on the server and the owning client from the
+ * inventory's slot changes. Only the links replicate; Items does not. Moves onto the hotbar link
+ * the inventory slot, moves within it swap links and moves off it unlink. Links follow their item
+ * when the inventory moves or sorts it, and clear when it leaves the inventory or its slot empties.
  */
-UCLASS(ClassGroup=(Inventory), Blueprintable, BlueprintType, meta=(BlueprintSpawnableComponent, 
+UCLASS(ClassGroup=(Inventory), Blueprintable, BlueprintType, meta=(BlueprintSpawnableComponent,
 	DisplayName="Player Hotbar Component",
 	Category="Inventory System"))
 class SURVIVALGAME_API UPlayerHotbarComponent : public UItemContainerBase
@@ -20,7 +65,58 @@ class SURVIVALGAME_API UPlayerHotbarComponent : public UItemContainerBase
 public:
 	UPlayerHotbarComponent();
 
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	virtual void InitializeContainer() override;
+
+	/** Slots reference inventory slots instead of holding copies of their items */
+	UPROPERTY(EditDefaultsOnly, Category = "Container|Config")
+	bool bLinkedView;
+
+	bool IsLinkedView() const { return bLinkedView; }
+
+	/** Shows an inventory slot in a hotbar slot; INDEX_NONE clears it. Clients forward the call to the server. */
+	UFUNCTION(BlueprintCallable, Category = "Hotbar|Link")
+	void LinkSlot(int32 HotbarIndex, int32 InventoryIndex);
+
+	UFUNCTION(BlueprintCallable, Category = "Hotbar|Link")
+	void UnlinkSlot(int32 HotbarIndex) { LinkSlot(HotbarIndex, INDEX_NONE); }
+
+	UFUNCTION(Server, Reliable)
+	void Server_LinkSlot(int32 HotbarIndex, int32 InventoryIndex);
+
+	/** Inventory slot a hotbar slot shows, or INDEX_NONE */
+	UFUNCTION(BlueprintPure, Category = "Hotbar|Link")
+	int32 GetLinkedSlot(int32 HotbarIndex) const;
+
+	/** Runs a move command with a hotbar end as a link change. Server only, linked view only. */
+	bool ApplyLinkMove(const FSlotMoveCommand& Command);
+
 protected:
 	/** Configure the default values in BeginPlay */
 	virtual void BeginPlay() override;
-};
\ No newline at end of file
+
+	/** One entry per hotbar slot. Owner only. */
+	UPROPERTY(ReplicatedUsing = OnRep_Links)
+	TArray<FHotbarSlotLink> Links;
+
+	UFUNCTION()
+	void OnRep_Links();
+
+	/** Mirrors a changed inventory slot into every hotbar slot linked to it; on the server, unlinks slots that emptied */
+	UFUNCTION()
+	void HandleSourceSlotChanged(int32 SlotIndex, const FItemStructure& Item);
+
+private:
+	/** Follows inventory items that moved to another slot or left the inventory. Server only. */
+	void HandleSourceSlotsMoved(const TMap<int32, int32>& OldToNewSlot);
+
+	/** Points a hotbar slot at an inventory slot (INDEX_NONE to clear) and refreshes it */
+	void SetLink(int32 HotbarIndex, int32 InventoryIndex);
+
+	/** Rewrites a hotbar slot's local copy from the slot it links to */
+	void RefreshLinkedSlot(int32 HotbarIndex);
+
+	/** The owner's inventory, found and bound on BeginPlay */
+	TWeakObjectPtr<UItemContainerBase> LinkSource;
+};
@@ -8,7 +8,6 @@
 #include "Enums/ItemEnums.h"
 #include "PlayerInventory.generated.h"
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWeightChanged, float, NewWeight, float, MaxWeight);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventoryExpanded, int32, OldSize, int32, NewSize);
 
 /**
@@ -34,15 +33,10 @@ public:
 
     UPlayerInventory();
 
-    TWeakObjectPtr<AActor> CachedOwner;
-
     virtual void BeginPlay() override;
 
     virtual void HandleSlotDrop(UItemContainerBase* HandleFromContainer, int32 HandleFromItemIndex, int32 HandleDroppedItemIndex) override;
 
-    virtual void AddItemToIndex(const FItemStructure& ItemInfo, int32 LocalSpecificIndex, int32 LocalItemIndex, bool& Success) override;
-
-    virtual void RemoveItemAtIndex(int32 RemovedIndex, bool& Success) override;
         
 
 };
\ No newline at end of file
@@ -0,0 +1,84 @@
+// StorageContainer.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Inventory/ItemContainerBase.h"
+#include "StorageContainer.generated.h"
+
+class UStorageSubsystem;
+
+/**
+ * @brief World storage (chests, crates) whose contents are paged in and out by UStorageSubsystem.
+ *
+ * The component registers with the subsystem instead of allocating its slots in BeginPlay.
+ * Contents stay serialized until EnsureResident is called, either by interaction code opening
+ * the chest or by any slot read or write through the base container, and the subsystem pages
+ * them back out after the chest has been idle for a while.
+ */
+UCLASS(ClassGroup=(Inventory), Blueprintable, BlueprintType, meta=(
+    BlueprintSpawnableComponent,
+    DisplayName="Storage Container Component",
+    Category="Inventory System"))
+class SURVIVALGAME_API UStorageContainer : public UItemContainerBase
+{
+    GENERATED_BODY()
+
+public:
+    UStorageContainer();
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+#if WITH_EDITOR
+    virtual void OnRegister() override;
+    virtual void PostEditImport() override;
+    virtual void PostDuplicate(bool bDuplicateForPIE) override;
+#endif
+
+    /**
+     * Persistent id the contents are stored under. Assigned when the chest is placed in the editor
+     * and saved with the level; placed chests saved before that fall back to an id derived from
+     * their path. Chests spawned at runtime rely on the save game to restore it.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, SaveGame, Category = "Container|Storage")
+    FGuid StorageId;
+
+    /** Loads the contents if they were paged out and resets the idle timer. Server only. */
+    UFUNCTION(BlueprintCallable, Category = "Container|Storage")
+    bool EnsureResident();
+
+    UFUNCTION(BlueprintPure, Category = "Container|Storage")
+    bool IsResident() const { return bResident; }
+
+    /** Opening the chest pages it in; it stays resident while anyone has it open */
+    virtual void AddViewer(APlayerController* Viewer) override;
+
+protected:
+    /** Registers with the storage subsystem; slots are only allocated once the chest is made resident */
+    virtual void InitializeContainer() override;
+
+    /** Pages the chest in before the base container reads or writes its slots */
+    virtual void PrepareSlotAccess() const override;
+
+private:
+    friend class UStorageSubsystem;
+
+    /** Allocates the slots and restores them from a snapshot (empty for a new chest). Only resident on success. */
+    bool Materialize(TConstArrayView<uint8> Snapshot);
+
+    /** Writes the contents into OutSnapshot and frees the slots */
+    void PageOut(TArray<uint8>& OutSnapshot);
+
+    UFUNCTION()
+    void HandleStorageSlotChanged(int32 SlotIndex, const FItemStructure& Item);
+
+    UStorageSubsystem* GetStorageSubsystem() const;
+
+    /** Fills in StorageId if nothing assigned one, stable across sessions where possible */
+    void EnsureStorageId();
+
+    bool bResident = false;
+
+    /** Set while contents are restored so the restore doesn't count as a change */
+    bool bRestoring = false;
+};
@@ -5,10 +5,47 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Components/Inventory/ItemSlotArray.h"
+#include "Components/Inventory/ItemSlotStore.h"
 #include "Data/Struct/ItemStructure.h"
 #include "Enums/ContainerType.h"
+#include "Enums/ItemEnums.h"
 #include "ItemContainerBase.generated.h"
 
+class APlayerController;
+class FItemContainerTransaction;
+
+/** Broadcast on server and clients whenever a single slot's contents change */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnContainerSlotChanged, int32, SlotIndex, const FItemStructure&, Item);
+
+/** Broadcast once per frame at most when the container's total weight changes */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWeightChanged, float, NewWeight, float, MaxWeight);
+
+/** Broadcast when the total weight crosses into another weight class */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWeightClassChanged, E_WeightClass, NewWeightClass);
+
+/** Server only: old slot -> new slot for items that moved within the container; INDEX_NONE if the item left it */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnContainerSlotsMoved, const TMap<int32, int32>& /*OldToNewSlot*/);
+
+/**
+ * @brief Outcome of adding one entry through UItemContainerBase::AddItems
+ */
+USTRUCT(BlueprintType)
+struct SURVIVALGAME_API FItemAddResult
+{
+    GENERATED_BODY()
+
+    /** True when the whole requested quantity was stored */
+    UPROPERTY(BlueprintReadOnly, Category = "Container")
+    bool bFullyAdded = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Container")
+    int32 QuantityAdded = 0;
+
+    /** Quantity that did not fit or could not be resolved */
+    UPROPERTY(BlueprintReadOnly, Category = "Container")
+    int32 QuantityRemaining = 0;
+};
 
 /**
  * @brief Base component class for handling item storage and management
@@ -21,8 +58,11 @@ class SURVIVALGAME_API UItemContainerBase : public UActorComponent
 public:
     UItemContainerBase();
 
+    virtual void PostInitProperties() override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 
     /** Container configuration */
@@ -32,47 +72,176 @@ public:
     UPROPERTY(EditDefaultsOnly, Category = "Container|Config")
     int32 MaxSlots;
 
+    /** Carry capacity the weight class is measured against; 0 means unlimited (always Light when loaded) */
+    UPROPERTY(EditDefaultsOnly, Category = "Container|Config", meta = (ClampMin = "0"))
+    float MaxWeight;
+
+    /** Fractions of MaxWeight at which the container becomes Medium and Heavy */
+    UPROPERTY(EditDefaultsOnly, Category = "Container|Config", meta = (ClampMin = "0", ClampMax = "1"))
+    float MediumLoadFraction;
+
+    UPROPERTY(EditDefaultsOnly, Category = "Container|Config", meta = (ClampMin = "0", ClampMax = "1"))
+    float HeavyLoadFraction;
+
+    /**
+     * Replicate the contents only to the owning connection and to players that opened the
+     * container through AddViewer, instead of to every connection the actor is relevant to.
+     * The owning actor must replicate using the registered subobject list.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "Container|Replication")
+    bool bViewerScopedReplication;
+
     UFUNCTION(BlueprintCallable, Category = "Container|Debug")
     void DebugContainerState();
 
-    /** Container state */
-    UPROPERTY(ReplicatedUsing = OnRep_Items)
-    TArray<FItemStructure> Items;
+    /** Container state, delta-replicated per slot. Push based: write only through SetSlotItem/ResetSlotState. */
+    UPROPERTY(Replicated)
+    FItemSlotArray Items;
+
+    /** Fired for every slot change, including changes received through replication */
+    UPROPERTY(BlueprintAssignable, Category = "Container|Events")
+    FOnContainerSlotChanged OnSlotChanged;
+
+    UPROPERTY(BlueprintAssignable, Category = "Container|Events")
+    FOnWeightChanged OnWeightChanged;
+
+    UPROPERTY(BlueprintAssignable, Category = "Container|Events")
+    FOnWeightClassChanged OnWeightClassChanged;
+
+    /**
+     * Fired when TransferItem or SortContainer relocate whole stacks, so references to slots can follow
+     * their items. Slot contents are already written, but it comes before their OnSlotChanged.
+     */
+    FOnContainerSlotsMoved OnSlotsMoved;
 
     /** Cached owner reference */
     UPROPERTY()
     AActor* OwningActor;
 
     /** Initialize container slots */
-    void InitializeContainer();
+    virtual void InitializeContainer();
 
-    /** Network replication */
-    UFUNCTION()
-    void OnRep_Items() {}
+    /** Network replication - called by Items for every slot a client receives */
+    void HandleSlotReplicated(int32 SlotIndex);
 
     UFUNCTION(Server, Reliable)
     void Server_AddItem(const FItemStructure& Item);
 
+    /** Marks a slot for the next change notification; kept for Blueprint callers, slot writes already do this */
     UFUNCTION(BlueprintCallable, Category = "Container|Events")
     void UpdateUI(int32 Index, const FItemStructure& ItemInfo);
 
+    /** Queues a slot for the end-of-frame change notification */
+    void MarkSlotDirty(int32 Index);
+
+    /** Sends every dirty slot to the owner in one UpdateItems call. Runs from tick and when a batch closes. */
+    void FlushDirtySlots();
+
 
     /** Find empty slot in container */
     UFUNCTION(BlueprintPure, Category = "Container|Operations")
     bool FindEmptySlot(bool& Success, int32& EmptyIndex) const;
 
-    /** Add item to container */
+    /**
+     * Adds an item, topping up partial stacks first. Stack size and asset come from the item index
+     * for indexed items, whatever the caller sent.
+     * Returns true only if the whole quantity was added. A partial add is kept: on false some of the
+     * item may already be in the container, so don't treat false as "nothing picked up". Use AddItems
+     * to learn how much is left over. Clients forward the call to the server and get true.
+     */
     UFUNCTION(BlueprintCallable, Category = "Container|Operations")
     bool AddItem(const FItemStructure& Item);
 
+    /**
+     * Adds several items in one pass with a single change notification.
+     * Clients forward the whole batch in one RPC and receive no results.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Container|Operations")
+    TArray<FItemAddResult> AddItems(const TArray<FItemStructure>& InItems);
+
+    UFUNCTION(Server, Reliable)
+    void Server_AddItems(const TArray<FItemStructure>& InItems);
+
+    /**
+     * Merges partial stacks, then reorders items by SortMethod and packs them to the front.
+     * Keys come from the item index, so no item asset is loaded. None only merges and compacts.
+     * Value is unsupported and leaves the container untouched. All moved slots are sent as one change set.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Container|Operations")
+    void SortContainer(E_SortMethod SortMethod);
+
+    UFUNCTION(Server, Reliable)
+    void Server_SortContainer(E_SortMethod SortMethod);
+
+    /** Clears several slots with a single change notification. Returns one success flag per index. */
+    UFUNCTION(BlueprintCallable, Category = "Container|Operations")
+    TArray<bool> RemoveItems(const TArray<int32>& SlotIndices);
+
+    /** Defers OnSlotChanged broadcasts and the owner notification until the matching EndSlotBatch. Batches may nest. */
+    void BeginSlotBatch();
+
+    /** Closes a batch; the outermost call sends one notification for every slot touched */
+    void EndSlotBatch();
+
+    bool IsBatchingSlotUpdates() const { return SlotBatchDepth > 0; }
+
+    /** Starts replicating the contents to a player's connection. Server only. */
+    virtual void AddViewer(APlayerController* Viewer);
+
+    /** Stops replicating the contents to a player, unless it owns the container. Server only. */
+    virtual void RemoveViewer(APlayerController* Viewer);
+
+    /** Whether any player currently has the container open */
+    bool HasViewers() const;
+
+    /** Whether slot changes reach the owner's widgets as slot updates; other containers are only seen through replication */
+    bool SendsSlotUpdates() const;
+
+    /** Transaction currently journaling this container's slot writes, if any */
+    FItemContainerTransaction* GetActiveTransaction() const { return ActiveTransaction; }
+
     UFUNCTION(Server, Reliable)
     void OnSlotDrop(UItemContainerBase* FromContainer, int32 FromItemIndex, int32 DroppedItemIndex);
 
     UFUNCTION(BlueprintCallable, Category = "Container|Operations")
     virtual void HandleSlotDrop (UItemContainerBase* HandleFromContainer, int32 HandleFromItemIndex, int32 HandleDroppedItemIndex);
 
+    /**
+     * Moves a stack into another slot: into an empty slot, onto a matching stack with room, or swapped.
+     * Returns false, changing nothing, if the move is invalid or a slot write fails.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Container|Operations")
+    bool TransferItem(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToTransfer);
+
+    /**
+     * Moves Quantity items of a stack into an empty slot or onto a matching stack with room,
+     * leaving the rest behind. Returns false, changing nothing, if they don't all fit.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Container|Operations")
+    bool TransferItemQuantity(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToTransfer, int32 Quantity);
+
+    /**
+     * Takes Quantity items off a stack into an empty slot of ToComponent, which may be this container.
+     * ToSpecificIndex INDEX_NONE picks the first empty slot. At least one item stays behind.
+     * Clients forward the call in one RPC and get false back, so they must call it on a container
+     * their pawn owns; stacks in opened containers go through the character's move commands.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Container|Operations")
+    bool SplitStack(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToSplit, int32 Quantity);
+
+    UFUNCTION(Server, Reliable)
+    void Server_SplitStack(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToSplit, int32 Quantity);
+
+    /**
+     * Moves up to Quantity items of a stack (0 = all of it) onto a matching stack of ToComponent,
+     * as many as there is room for. ToSpecificIndex INDEX_NONE tops up every partial stack of the
+     * item in slot order. Returns the quantity moved; clients forward the call in one RPC and get 0.
+     */
     UFUNCTION(BlueprintCallable, Category = "Container|Operations")
-    void TransferItem(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToTransfer);
+    int32 MergeStack(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToMerge, int32 Quantity);
+
+    UFUNCTION(Server, Reliable)
+    void Server_MergeStack(UItemContainerBase* ToComponent, int32 ToSpecificIndex, int32 ItemIndexToMerge, int32 Quantity);
 
     UFUNCTION(BlueprintPure, Category = "Container|Operations")
     bool IsSlotEmpty(int32 SlotIndex) const;
@@ -80,6 +249,61 @@ public:
     UFUNCTION(BlueprintPure, Category = "Container|Operations")
     FItemStructure GetItemAtIndex(int32 Index) const;
 
+    /** Total quantity of an item across all slots */
+    UFUNCTION(BlueprintPure, Category = "Container|Operations")
+    int32 CountItem(FName RegistryKey) const;
+
+    /**
+     * Queries answered from per-category and per-type slot bitsets and per-key totals,
+     * kept current by every slot write. None of them scan all slots or load item assets.
+     */
+    UFUNCTION(BlueprintPure, Category = "Container|Query")
+    bool HasAnyItem(FName RegistryKey) const;
+
+    UFUNCTION(BlueprintPure, Category = "Container|Query")
+    bool HasAnyOfCategory(E_ItemCategory Category) const;
+
+    UFUNCTION(BlueprintPure, Category = "Container|Query")
+    bool HasAnyOfType(E_ItemType Type) const;
+
+    /** Lowest slot holding the item, or INDEX_NONE */
+    UFUNCTION(BlueprintPure, Category = "Container|Query")
+    int32 FirstSlotOfItem(FName RegistryKey) const;
+
+    UFUNCTION(BlueprintPure, Category = "Container|Query")
+    int32 FirstSlotOfCategory(E_ItemCategory Category) const;
+
+    UFUNCTION(BlueprintPure, Category = "Container|Query")
+    int32 FirstSlotOfType(E_ItemType Type) const;
+
+    /** Calls Visitor with each slot index holding the item / category / type, in ascending order */
+    void ForEachSlotOfItem(FName RegistryKey, TFunctionRef<void(int32 SlotIndex)> Visitor) const;
+    void ForEachSlotOfCategory(E_ItemCategory Category, TFunctionRef<void(int32 SlotIndex)> Visitor) const;
+    void ForEachSlotOfType(E_ItemType Type, TFunctionRef<void(int32 SlotIndex)> Visitor) const;
+
+    /** Running weight of everything stored, kept up to date on every slot write */
+    UFUNCTION(BlueprintPure, Category = "Container|Weight")
+    float GetTotalWeight() const { PrepareSlotAccess(); return static_cast<float>(TotalWeightMilli) / 1000.0f; }
+
+    UFUNCTION(BlueprintPure, Category = "Container|Weight")
+    E_WeightClass GetWeightClass() const { PrepareSlotAccess(); return WeightClass; }
+
+    /** Total quantity stored of items in a category */
+    UFUNCTION(BlueprintPure, Category = "Container|Weight")
+    int32 GetCategoryCount(E_ItemCategory Category) const;
+
+    /** Appends a binary snapshot of the occupied slots (see FItemContainerSnapshot) */
+    void SaveSnapshot(TArray<uint8>& OutBytes) const;
+
+    /**
+     * Replaces the contents with a snapshot, decoded straight from Bytes. Server only.
+     * A malformed snapshot or one that doesn't fit leaves the container unchanged and returns false.
+     */
+    bool LoadSnapshot(TConstArrayView<uint8> Bytes);
+
+    /** Read-only access to the structure-of-arrays slot data used for scans */
+    const FItemSlotStore& GetSlotStore() const { return SlotStore; }
+
     UFUNCTION(BlueprintCallable, Category = "Container|Operations")
     virtual void AddItemToIndex(const FItemStructure& ItemInfo, int32 LocalSpecificIndex, int32 LocalItemIndex, bool& Success);
 
@@ -89,7 +313,121 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Container|Debug")
     virtual void RemoveItemAtIndex(int32 RemovedIndex, bool& Success);
 
-    
+protected:
+    /**
+     * Called at the top of every public slot read and write, before the slot state is touched.
+     * Containers that page their contents out load them back here; the default does nothing.
+     */
+    virtual void PrepareSlotAccess() const {}
+
+    /** Single write path for slot contents; marks the slot for delta replication */
+    void SetSlotItem(int32 Index, const FItemStructure& Item);
+
+    /** Whether an item structure counts as occupying a slot */
+    static bool IsOccupyingItem(const FItemStructure& Item);
+
+    /** Keeps the occupancy bit of a slot in sync with its contents */
+    void UpdateOccupancy(int32 Index, const FItemStructure& Item);
+
+    /** Puts this component in its own net condition group plus the owner group */
+    void SetupViewerScopedReplication();
+
+    /** Net condition group of the players viewing this container */
+    FName ViewerNetGroup;
+
+    /** Players currently subscribed to the contents */
+    TArray<TWeakObjectPtr<APlayerController>> Viewers;
+
+    /** Whether the player owning this container may move items into Target: same owner, or Target open to them */
+    bool CanOwnerReach(const UItemContainerBase* Target) const;
+
+    /** Sizes every per-slot structure to NumSlots empty slots and clears the totals (server only) */
+    void ResetSlotState(int32 NumSlots);
+
+    /** Hot/cold split copy of Items kept in sync by SetSlotItem and HandleSlotReplicated */
+    FItemSlotStore SlotStore;
+
+    /** Writes a slot into SlotStore and moves its contribution in the totals and query indices */
+    void WriteSlotStore(int32 Index, const FItemStructure& Item);
+
+    /** Keeps the category/type bitsets and per-key counts in sync when a slot changes */
+    void UpdateQueryIndex(int32 Index, int32 OldDefinitionId, FName OldKey, int32 OldQuantity);
+
+    /** Visits the slots holding an item in ascending order until Visitor returns false */
+    void ScanSlotsOfItem(FName RegistryKey, TFunctionRef<bool(int32 SlotIndex)> Visitor) const;
+
+    /** One bitset per E_ItemCategory value, one bit per slot holding an item of that category */
+    TArray<TBitArray<>> CategorySlots;
+
+    /** One bitset per E_ItemType value, one bit per slot holding an item of that type */
+    TArray<TBitArray<>> TypeSlots;
+
+    /** Registry key -> total quantity stored */
+    TMap<FName, int32> ItemCounts;
+
+    /** One bit per slot, set when the slot holds an item. Answers free-slot queries without touching Items. */
+    TBitArray<> OccupiedSlots;
+
+    /** Whether an item is a stack with room left */
+    static bool IsPartialStack(const FItemStructure& Item);
+
+    /** Keeps PartialStackSlots in sync when a slot changes from OldItem to NewItem */
+    void UpdateStackIndex(int32 Index, const FItemStructure& OldItem, const FItemStructure& NewItem);
+
+    /**
+     * Takes ItemAsset and StackSize from the item index for indexed keys, since callers (and clients)
+     * can't be trusted with either. Unindexed items keep their own asset. Returns false if there is none.
+     */
+    bool ResolveItemDefinition(FItemStructure& InOutItem) const;
+
+    /** Merges into partial stacks, then spills into empty slots. Returns the quantity that did not fit. */
+    int32 PlaceItem(const FItemStructure& Item);
+
+    /** Registry key -> ascending slot indices holding a partial stack of that item (server only) */
+    TMap<FName, TArray<int32>> PartialStackSlots;
+
+    /**
+     * Moves a slot's contribution out of the running totals and adds the new one.
+     * Weight and category come from the item index, so no item asset is loaded.
+     */
+    void UpdateTotals(int32 OldDefinitionId, int32 OldQuantity, int32 NewDefinitionId, int32 NewQuantity);
+
+    /** Weight class for a given total, using MaxWeight and the load fractions */
+    E_WeightClass ComputeWeightClass(int64 WeightMilli) const;
+
+    /** Fires the weight delegates if the totals moved since the last broadcast */
+    void BroadcastTotalsIfChanged();
+
+    /** Total weight in thousandths, so adding and removing never drifts */
+    int64 TotalWeightMilli = 0;
+
+    /** Stored quantity per E_ItemCategory value */
+    TArray<int32> CategoryCounts;
+
+    E_WeightClass WeightClass = E_WeightClass::None;
+
+    /** Weight last sent through OnWeightChanged */
+    int64 BroadcastWeightMilli = 0;
+
+    /** Sends the current contents of the given slots to the owner in a single interface call */
+    void NotifySlotsChanged(const TArray<int32>& SlotIndices);
+
+    /** One bit per slot written since the last flush */
+    TBitArray<> DirtySlots;
+
+    /** Open BeginSlotBatch calls */
+    int32 SlotBatchDepth = 0;
+
+    /** Slots touched while a batch is open, waiting for their OnSlotChanged broadcast */
+    TArray<int32> PendingBatchSlots;
+
+    /** Closes a batch after discarding every slot queued past PendingSlotMark */
+    void CancelSlotBatch(int32 PendingSlotMark);
+
+    /** Set while enlisted in a transaction; SetSlotItem journals through it */
+    FItemContainerTransaction* ActiveTransaction = nullptr;
+
+    friend class FItemContainerTransaction;
 
 };
 
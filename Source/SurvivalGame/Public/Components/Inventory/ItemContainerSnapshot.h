@@ -0,0 +1,105 @@
+// ItemContainerSnapshot.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/Struct/ItemStructure.h"
+
+class UItemContainerBase;
+struct FItemSlotStore;
+
+/**
+ * @brief Versioned binary snapshot of a container's contents, for save games, server migration and fixtures.
+ *
+ * Layout (all integers are LEB128 varints unless noted, signed values zigzag encoded):
+ *   Header:  Magic (uint32 LE) | SchemaVersion (uint8) | MinReaderVersion (uint8)
+ *            | ExtraHeaderBytes + bytes | SlotCount | IdCount | Id table | RecordCount
+ *   Id:      KeyLength + UTF-8 key | PathLength + UTF-8 asset path
+ *   Record:  RecordLength | SlotGap | IdIndex | Flags (uint8) | optional fields
+ *
+ * Only occupied slots get a record, and slot indices are stored as the gap from the previous
+ * record. Items refer to the id table by registry key rather than by net index, so snapshots
+ * survive content changes that reorder the item index.
+ *
+ * Forward compatibility: newer writers append header fields inside ExtraHeaderBytes and new
+ * record fields after the known ones; older readers skip both using the stored lengths.
+ * A writer that changes meaning instead of appending raises MinReaderVersion, and older
+ * readers refuse the snapshot. Versions older than OldestReadableVersion have no upgrade
+ * path and are refused with an error; raise it when the record layout changes incompatibly.
+ */
+struct SURVIVALGAME_API FItemContainerSnapshot
+{
+    static constexpr uint32 Magic = 0x43494753; // "SGIC"
+    static constexpr uint8 SchemaVersion = 1;
+
+    /** Oldest schema version the reader decodes; anything before it is refused */
+    static constexpr uint8 OldestReadableVersion = 1;
+
+    /** Appends a snapshot of every occupied slot to OutBytes */
+    static void Write(const UItemContainerBase& Container, TArray<uint8>& OutBytes);
+
+    /** Same for a range of a slot store; slot indices in the snapshot are relative to FirstSlot */
+    static void Write(const FItemSlotStore& Store, int32 FirstSlot, int32 NumSlots, TArray<uint8>& OutBytes);
+};
+
+/**
+ * @brief Decodes a snapshot straight from a memory buffer without copying it.
+ *
+ * The id table is resolved into inline storage (no heap use for up to InlineIdCount distinct
+ * items) and records are decoded one at a time. Asset paths are taken from the item index when
+ * the key is known, so the stored path is only parsed for items outside the index.
+ *
+ * Usage:
+ *   FItemContainerSnapshotReader Reader(Bytes);
+ *   int32 SlotIndex; FItemStructure Item;
+ *   while (Reader.Next(SlotIndex, Item)) { ... }
+ *   if (Reader.HasError()) { ... }
+ */
+class SURVIVALGAME_API FItemContainerSnapshotReader
+{
+public:
+    static constexpr int32 InlineIdCount = 64;
+
+    explicit FItemContainerSnapshotReader(TConstArrayView<uint8> InBuffer);
+
+    /** Decodes the next occupied slot. Returns false at the end or on malformed data. */
+    bool Next(int32& OutSlotIndex, FItemStructure& OutItem);
+
+    bool HasError() const { return bError; }
+
+    uint8 GetSchemaVersion() const { return Version; }
+    int32 GetSlotCount() const { return SlotCount; }
+    int32 GetRecordCount() const { return RecordCount; }
+
+private:
+    bool ReadHeader();
+
+    bool ReadByte(uint8& OutValue);
+    bool ReadVarint(uint64& OutValue);
+    bool ReadVarint32(int32& OutValue);
+    bool ReadSignedVarint(int32& OutValue);
+    bool ReadFloat(float& OutValue);
+    bool ReadBytes(int32 Length, const uint8*& OutData);
+
+    /** Fails the read; later calls return false */
+    bool Fail(const TCHAR* Reason);
+
+    struct FIdEntry
+    {
+        FName RegistryKey;
+        const uint8* PathData = nullptr;
+        int32 PathLength = 0;
+    };
+
+    TConstArrayView<uint8> Buffer;
+    int32 Offset = 0;
+
+    TArray<FIdEntry, TInlineAllocator<InlineIdCount>> Ids;
+
+    uint8 Version = 0;
+    int32 SlotCount = 0;
+    int32 RecordCount = 0;
+    int32 RecordsRead = 0;
+    int32 PreviousSlot = INDEX_NONE;
+    bool bError = false;
+};
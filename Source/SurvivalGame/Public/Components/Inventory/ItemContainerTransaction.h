@@ -0,0 +1,69 @@
+// ItemContainerTransaction.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/Struct/ItemStructure.h"
+
+class UItemContainerBase;
+
+/**
+ * @brief Journal of slot writes across one or more containers that commit or roll back together.
+ *
+ * Enlisting a container opens a slot batch on it and routes every slot write it makes
+ * (including writes done by AddItem, RemoveItemAtIndex, etc.) into this journal.
+ * Commit closes the batches so each container sends a single change set; Rollback restores
+ * every journaled slot and drops the pending notifications. A transaction that goes out of
+ * scope while still open is rolled back.
+ *
+ * Usage (crafting):
+ *   FItemContainerTransaction Transaction;
+ *   Transaction.Enlist(Inventory);
+ *   Inventory->RemoveItems(InputSlots);
+ *   if (!Inventory->AddItem(Output)) { Transaction.Rollback(); } else { Transaction.Commit(); }
+ */
+class SURVIVALGAME_API FItemContainerTransaction : public FNoncopyable
+{
+public:
+    FItemContainerTransaction() = default;
+    ~FItemContainerTransaction();
+
+    /** Starts journaling a container. Fails if it already belongs to another open transaction. */
+    bool Enlist(UItemContainerBase* Container);
+
+    /** Journaled write of a single slot. Enlists the container if needed. */
+    bool SetSlot(UItemContainerBase* Container, int32 SlotIndex, const FItemStructure& Item);
+
+    /** Keeps all writes and sends one change notification per container */
+    void Commit();
+
+    /** Restores every written slot to its value before the transaction */
+    void Rollback();
+
+    bool IsOpen() const { return bOpen; }
+
+private:
+    friend class UItemContainerBase;
+
+    /** Called by enlisted containers before a slot is overwritten */
+    void RecordWrite(UItemContainerBase* Container, int32 SlotIndex, const FItemStructure& PreviousItem);
+
+    struct FJournalEntry
+    {
+        TWeakObjectPtr<UItemContainerBase> Container;
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure PreviousItem;
+    };
+
+    struct FParticipant
+    {
+        TWeakObjectPtr<UItemContainerBase> Container;
+
+        /** Pending batch slot count when the container was enlisted */
+        int32 PendingSlotMark = 0;
+    };
+
+    TArray<FJournalEntry> Journal;
+    TArray<FParticipant> Participants;
+    bool bOpen = true;
+};
@@ -0,0 +1,95 @@
+// ItemSlotArray.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Data/Struct/ItemStructure.h"
+#include "ItemSlotArray.generated.h"
+
+class UItemContainerBase;
+struct FItemSlotArray;
+
+/**
+ * @brief A single replicated container slot.
+ *
+ * Each entry carries its own slot index so client callbacks always resolve to the
+ * correct UI slot, independent of the order the fast array delivers entries in.
+ */
+USTRUCT()
+struct SURVIVALGAME_API FItemSlotEntry : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    /** Slot this entry represents inside the owning container */
+    UPROPERTY()
+    int32 SlotIndex = INDEX_NONE;
+
+    /** Item stored in the slot (empty structure when the slot is free) */
+    UPROPERTY()
+    FItemStructure Item;
+
+    /** Fast array client callbacks */
+    void PostReplicatedAdd(const FItemSlotArray& InArraySerializer);
+    void PostReplicatedChange(const FItemSlotArray& InArraySerializer);
+    void PreReplicatedRemove(const FItemSlotArray& InArraySerializer);
+};
+
+/**
+ * @brief Delta-replicated slot list for item containers.
+ *
+ * Only slots that were marked dirty are sent over the wire, and clients receive
+ * per-slot add/change/remove callbacks that are forwarded to the owning container.
+ * The list is sized once by Init() and entries are never added or removed afterwards,
+ * so on the server the entry index always equals the slot index.
+ */
+USTRUCT()
+struct SURVIVALGAME_API FItemSlotArray : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    /** Creates NumSlots empty entries and marks the whole array for replication */
+    void Init(UItemContainerBase* InOwner, int32 NumSlots);
+
+    /** Sets the owning container used to route client callbacks */
+    void SetOwner(UItemContainerBase* InOwner) { Owner = InOwner; }
+
+    int32 Num() const { return Entries.Num(); }
+
+    bool IsValidIndex(int32 SlotIndex) const { return FindEntryIndex(SlotIndex) != INDEX_NONE; }
+
+    /** Read access by slot index. The index must be valid. */
+    const FItemStructure& operator[](int32 SlotIndex) const;
+
+    /** Writes a slot and marks only that entry dirty for replication */
+    void SetSlot(int32 SlotIndex, const FItemStructure& Item);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FItemSlotEntry, FItemSlotArray>(Entries, DeltaParms, *this);
+    }
+
+private:
+    friend struct FItemSlotEntry;
+
+    /** Maps a slot index to its entry; fast path assumes entries are stored in slot order */
+    int32 FindEntryIndex(int32 SlotIndex) const;
+
+    /** Notifies the owner that a slot changed through replication */
+    void NotifySlotReplicated(int32 SlotIndex) const;
+
+    UPROPERTY()
+    TArray<FItemSlotEntry> Entries;
+
+    /** Owning container. Not a UPROPERTY so archetype copies never overwrite it. */
+    UItemContainerBase* Owner = nullptr;
+};
+
+template<>
+struct TStructOpsTypeTraits<FItemSlotArray> : public TStructOpsTypeTraitsBase2<FItemSlotArray>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
@@ -0,0 +1,68 @@
+// ItemSlotStore.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/Struct/ItemStructure.h"
+
+/**
+ * Fields of a slot that only matter when the whole item is read back or shown
+ */
+struct FItemSlotColdData
+{
+    FName RegistryKey;
+    TSoftObjectPtr<UItemInfo> ItemAsset;
+    float CurrentHP = 0.0f;
+    float MaxHP = 0.0f;
+    int32 CurrentAmmo = 0;
+    int32 MaxAmmo = 0;
+};
+
+/**
+ * @brief Structure-of-arrays copy of a container's slots.
+ *
+ * The hot fields used by scans (definition id, quantity, stack size) live in dense parallel
+ * arrays, everything else in a separate cold array. Counting an item or walking quantities
+ * only touches the hot arrays instead of striding over whole FItemStructure rows.
+ * Definition ids are the item net indices from USurvivalAssetManager; INDEX_NONE marks an
+ * empty slot or an item outside the index (whose key is still kept in the cold data).
+ *
+ * The replicated FItemSlotArray stays the source of truth on the wire; UItemContainerBase
+ * writes both through SetSlotItem and refreshes this store for every replicated slot.
+ */
+struct SURVIVALGAME_API FItemSlotStore
+{
+    /** Resets to NumSlots empty slots */
+    void Init(int32 NumSlots);
+
+    /** Adds empty slots until there are at least NumSlots (clients size the store as slots arrive) */
+    void Reserve(int32 NumSlots);
+
+    int32 Num() const { return Quantities.Num(); }
+
+    bool IsValidIndex(int32 SlotIndex) const { return Quantities.IsValidIndex(SlotIndex); }
+
+    /** Splits an item into the hot and cold arrays */
+    void Set(int32 SlotIndex, const FItemStructure& Item);
+
+    /** Rebuilds the full item structure for a slot */
+    FItemStructure MakeItem(int32 SlotIndex) const;
+
+    int32 GetDefinitionId(int32 SlotIndex) const { return DefinitionIds[SlotIndex]; }
+    int32 GetQuantity(int32 SlotIndex) const { return Quantities[SlotIndex]; }
+    int32 GetStackSize(int32 SlotIndex) const { return StackSizes[SlotIndex]; }
+    FName GetRegistryKey(int32 SlotIndex) const { return ColdData[SlotIndex].RegistryKey; }
+
+    /** Dense hot arrays, indexed by slot */
+    const TArray<int32>& GetDefinitionIds() const { return DefinitionIds; }
+    const TArray<int32>& GetQuantities() const { return Quantities; }
+
+    /** Total quantity of an item across all slots */
+    int32 CountOf(FName RegistryKey) const;
+
+private:
+    TArray<int32> DefinitionIds;
+    TArray<int32> Quantities;
+    TArray<int32> StackSizes;
+    TArray<FItemSlotColdData> ColdData;
+};
@@ -0,0 +1,55 @@
+// SlotMoveCommand.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enums/ContainerType.h"
+#include "SlotMoveCommand.generated.h"
+
+/**
+ * @brief One slot-to-slot move queued by a client and executed by the server's move dispatcher.
+ *
+ * Containers are identified by type and resolved on the server against the sending player's
+ * own containers and the ones it has open, so no object references go over the wire.
+ * A command usually packs into 5 or 6 bytes.
+ */
+USTRUCT(BlueprintType)
+struct SURVIVALGAME_API FSlotMoveCommand
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Move")
+    E_ContainerType FromContainer = E_ContainerType::None;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Move")
+    E_ContainerType ToContainer = E_ContainerType::None;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Move")
+    int32 FromIndex = INDEX_NONE;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Move")
+    int32 ToIndex = INDEX_NONE;
+
+    /** Items to move; 0 moves (or stacks, or swaps) the whole stack */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Move")
+    int32 Quantity = 0;
+
+    /** Client prediction this command was applied under (see FSlotMovePrediction); 0 if not predicted */
+    UPROPERTY()
+    int32 PredictionKey = 0;
+
+    /** Both containers set, indices and quantity not negative */
+    bool IsWellFormed() const;
+
+    /** Container types share one byte, indices, quantity and prediction key are zigzag packed ints */
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSlotMoveCommand> : public TStructOpsTypeTraitsBase2<FSlotMoveCommand>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
@@ -0,0 +1,99 @@
+// SlotMovePrediction.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Inventory/SlotMoveCommand.h"
+#include "Data/Struct/ItemStructure.h"
+
+/**
+ * @brief Client-side overlay of slot moves the server has not answered yet.
+ *
+ * PredictMove applies a move to predicted copies of the two slots it touches and tags it with
+ * a key. Authoritative slot contents received while a slot is predicted are kept aside
+ * (ConfirmSlot) instead of being shown. Reconcile retires every move up to the server's last
+ * processed key and shows the authoritative contents again; if any move was rejected, every
+ * outstanding prediction is dropped, since later moves were predicted on top of it.
+ * Containers that never send slot updates (opened chests) are read again when their slots retire.
+ */
+class SURVIVALGAME_API FSlotMovePrediction
+{
+public:
+    /** A slot whose displayed contents changed */
+    struct FDisplayChange
+    {
+        E_ContainerType ContainerType = E_ContainerType::None;
+        int32 SlotIndex = INDEX_NONE;
+        FItemStructure Item;
+    };
+
+    /**
+     * Applies Command on top of the current predictions. ReadConfirmed returns the last
+     * authoritative contents of a slot. Returns the move's key, or 0 (changing nothing) if
+     * the move isn't valid in the predicted view.
+     */
+    int32 PredictMove(const FSlotMoveCommand& Command,
+                      TFunctionRef<FItemStructure(E_ContainerType, int32)> ReadConfirmed,
+                      TArray<FDisplayChange>& OutChanges);
+
+    /** Records authoritative contents; returns true while the slot is predicted and must not be displayed yet */
+    bool ConfirmSlot(E_ContainerType ContainerType, int32 SlotIndex, const FItemStructure& Item);
+
+    /**
+     * Retires moves up to LastProcessedKey and rolls back rejected ones. ReadReplicated returns
+     * true, filling the item, for slots whose current replicated contents should be shown instead
+     * of the last ConfirmSlot value because their container sends no slot updates.
+     */
+    void Reconcile(int32 LastProcessedKey, TConstArrayView<int32> RejectedKeys,
+                   TFunctionRef<bool(E_ContainerType, int32, FItemStructure&)> ReadReplicated,
+                   TArray<FDisplayChange>& OutChanges);
+
+    bool HasPendingMoves() const { return !PendingMoves.IsEmpty(); }
+
+    void Reset();
+
+    /**
+     * The slot rules of UItemContainerBase::TransferItem and TransferItemQuantity: whole stacks
+     * move, top up a matching stack or swap; partial quantities only go to an empty slot or a
+     * matching stack with room. Returns false if the move does nothing.
+     */
+    static bool SimulateMove(FItemStructure& Source, FItemStructure& Destination, int32 Quantity);
+
+private:
+    struct FPredictedSlot
+    {
+        /** Latest authoritative contents, shown once the prediction retires */
+        FItemStructure Confirmed;
+        FItemStructure Predicted;
+
+        /** Newest move that wrote the slot */
+        int32 LatestKey = 0;
+    };
+
+    struct FPendingMove
+    {
+        int32 Key = 0;
+        uint64 FromSlot = 0;
+        uint64 ToSlot = 0;
+    };
+
+    static uint64 MakeSlotId(E_ContainerType ContainerType, int32 SlotIndex);
+    static void AddChange(uint64 SlotId, const FItemStructure& Item, TArray<FDisplayChange>& OutChanges);
+
+    /** Shows a slot's authoritative contents again */
+    static void AddConfirmedChange(uint64 SlotId, const FPredictedSlot& Slot,
+                                   TFunctionRef<bool(E_ContainerType, int32, FItemStructure&)> ReadReplicated,
+                                   TArray<FDisplayChange>& OutChanges);
+
+    /** Retires a slot if no newer move still predicts it */
+    void RetireSlot(uint64 SlotId, int32 Key, TFunctionRef<bool(E_ContainerType, int32, FItemStructure&)> ReadReplicated,
+                    TArray<FDisplayChange>& OutChanges);
+
+    /** Predicted slots by MakeSlotId */
+    TMap<uint64, FPredictedSlot> Slots;
+
+    /** Unanswered moves, oldest first */
+    TArray<FPendingMove> PendingMoves;
+
+    int32 NextKey = 1;
+};
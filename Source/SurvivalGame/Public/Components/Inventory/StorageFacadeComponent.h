@@ -0,0 +1,61 @@
+// StorageFacadeComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Core/StorageArenaSubsystem.h"
+#include "StorageFacadeComponent.generated.h"
+
+class UItemContainerBase;
+
+/**
+ * @brief Thin, non-replicated, non-ticking front end for a container stored in UStorageArenaSubsystem.
+ *
+ * Holds only a handle. Use it for chests that are rarely opened: the slots live in the shared
+ * arena, and OpenInto/StoreFrom copy them to and from a live UItemContainerBase (for example
+ * a looting container on the player) while a player has the chest open. Nothing is saved:
+ * the contents go with the arena block at EndPlay. Chests that persist use UStorageContainer.
+ */
+UCLASS(ClassGroup=(Inventory), Blueprintable, meta=(BlueprintSpawnableComponent, DisplayName="Storage Facade Component"))
+class SURVIVALGAME_API UStorageFacadeComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UStorageFacadeComponent();
+
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    UPROPERTY(EditDefaultsOnly, Category = "Container|Config")
+    int32 MaxSlots;
+
+    /** Adds an item, returning the quantity that did not fit. Server only. */
+    UFUNCTION(BlueprintCallable, Category = "Container|Operations")
+    int32 AddItem(const FItemStructure& Item);
+
+    UFUNCTION(BlueprintCallable, Category = "Container|Operations")
+    bool SetItemAtIndex(int32 SlotIndex, const FItemStructure& Item);
+
+    UFUNCTION(BlueprintPure, Category = "Container|Operations")
+    FItemStructure GetItemAtIndex(int32 SlotIndex) const;
+
+    UFUNCTION(BlueprintPure, Category = "Container|Operations")
+    int32 CountItem(FName RegistryKey) const;
+
+    /** Copies the stored contents into a live container for viewing */
+    UFUNCTION(BlueprintCallable, Category = "Container|Storage")
+    bool OpenInto(UItemContainerBase* Viewer);
+
+    /** Copies a live container's contents back into storage, e.g. when the chest is closed */
+    UFUNCTION(BlueprintCallable, Category = "Container|Storage")
+    bool StoreFrom(UItemContainerBase* Viewer);
+
+    const FStorageHandle& GetHandle() const { return Handle; }
+
+private:
+    UStorageArenaSubsystem* GetArena() const;
+
+    FStorageHandle Handle;
+};
@@ -0,0 +1,68 @@
+// InventoryBenchmarkCommandlet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Data/Struct/ItemStructure.h"
+#include "InventoryBenchmarkCommandlet.generated.h"
+
+/**
+ * @brief Headless micro-benchmarks for the container hot paths.
+ *
+ * Runs AddItem, TransferItem (move, swap, stack), RemoveItemAtIndex, FindEmptySlot and
+ * SortContainer on a UPlayerInventory in a transient world, at several container sizes, and
+ * reports ns/op, allocations/op, allocated bytes/op and slot writes/op. Results go to a CSV;
+ * a run fails (exit code 1) when a case is slower or allocates more than the baseline by more
+ * than the allowed margin, when a case has no baseline entry, or when the baseline is missing
+ * or malformed.
+ *
+ * A commandlet rather than an automation test: it swaps GMalloc to count allocations, which is
+ * only safe with nothing else running, and it needs the item index scanned from project content.
+ * Build/InventoryBenchmark.xml runs it headless on a Linux BuildGraph agent after compiling the
+ * editor. No baseline ships with the project: numbers only compare on the machine that recorded
+ * them, so the graph records one (-UpdateBaseline) until the reference agent's CSV is checked in.
+ *
+ * UnrealEditor-Cmd SurvivalGame.uproject -run=InventoryBenchmark -nullrhi -unattended
+ *   -Sizes=16,64,256,1024   container sizes to run
+ *   -Iterations=50          timed repetitions per case and size
+ *   -Margin=0.15            allowed regression against the baseline (fraction)
+ *   -Output=<path>          CSV to write, default Saved/Benchmarks/Inventory-<timestamp>.csv
+ *   -Baseline=<path>        default Build/Benchmarks/InventoryBaseline.csv
+ *   -UpdateBaseline         overwrite the baseline with this run instead of comparing
+ */
+UCLASS()
+class SURVIVALGAME_API UInventoryBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UInventoryBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    struct FBenchmarkResult
+    {
+        FString Case;
+        int32 NumSlots = 0;
+        double NsPerOp = 0.0;
+        double AllocsPerOp = 0.0;
+        double AllocBytesPerOp = 0.0;
+        double SlotWritesPerOp = 0.0;
+    };
+
+    /** Counts slot writes of the container under test */
+    UFUNCTION()
+    void HandleSlotChanged(int32 SlotIndex, const FItemStructure& Item);
+
+    int64 SlotWrites = 0;
+
+    static FString ToCsv(const TArray<FBenchmarkResult>& Results);
+
+    /** Header line, then one row per case; false if the header differs or any row is malformed */
+    static bool ParseCsv(const FString& Text, TArray<FBenchmarkResult>& OutResults);
+
+    /** Logs every case that regressed past Margin or has no baseline entry; returns how many */
+    static int32 CompareToBaseline(const TArray<FBenchmarkResult>& Results, const TArray<FBenchmarkResult>& Baseline, double Margin);
+};
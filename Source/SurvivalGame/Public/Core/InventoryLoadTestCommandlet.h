@@ -0,0 +1,61 @@
+// InventoryLoadTestCommandlet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GameFramework/Actor.h"
+#include "InventoryLoadTestCommandlet.generated.h"
+
+class UStorageContainer;
+
+/**
+ * @brief Headless server scaling test for inventory and pickup traffic.
+ *
+ * For each client count, starts a server world on ULoadTestNetDriver with that many simulated
+ * connections, each with a real player controller and AGamePlayerCharacter. Every bot runs a
+ * scripted workload: pickups (AddItem), drags and stack splits, chest looting (OpenContainer,
+ * moves between the chest and the inventory, CloseContainer) and drops. Moves are sent once per
+ * frame as Server_SubmitMoveCommands batches through the bot's connection, so their parameter
+ * serialization, validation and dispatch are measured; the other actions call the server entry
+ * points their RPCs would reach. Replication to the bots runs for real; only the final socket
+ * send is replaced by a byte counter.
+ *
+ * Reports server frame time percentiles, time spent after actor tick (mostly replication),
+ * bytes, packets and RPCs sent per connection, and RPCs and move-batch bytes received per
+ * connection, one CSV row per client count.
+ *
+ * UnrealEditor-Cmd SurvivalGame.uproject -run=InventoryLoadTest -nullrhi -unattended
+ *   -Clients=1,10,25,50,100,150   client counts to run
+ *   -Seconds=30                   measured duration per client count (after 2s of warm-up)
+ *   -TickRate=30                  server frames per second
+ *   -ActionsPerSecond=2           average bot actions per second
+ *   -PawnClass=<class path>       AGamePlayerCharacter subclass, default the native class
+ *   -Seed=1                       workload random seed
+ *   -Output=<path>                default Saved/LoadTests/Inventory-<timestamp>.csv
+ */
+UCLASS()
+class SURVIVALGAME_API UInventoryLoadTestCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UInventoryLoadTestCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
+
+/**
+ * @brief Minimal replicated chest the load test spawns next to its bots
+ */
+UCLASS(NotBlueprintable, Transient)
+class SURVIVALGAME_API ALoadTestStorageActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ALoadTestStorageActor();
+
+    UPROPERTY(VisibleAnywhere, Category = "Storage")
+    TObjectPtr<UStorageContainer> Storage;
+};
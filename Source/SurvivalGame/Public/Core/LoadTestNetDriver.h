@@ -0,0 +1,75 @@
+// LoadTestNetDriver.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "LoadTestNetDriver.generated.h"
+
+/**
+ * @brief In-process client connection for load tests.
+ *
+ * Runs the full server-side replication path (channels, property and RPC serialization,
+ * packet building) but hands finished packets to a byte counter instead of a socket.
+ * Reliability is acked internally, so no client has to answer.
+ */
+UCLASS(Transient)
+class SURVIVALGAME_API ULoadTestNetConnection : public UNetConnection
+{
+    GENERATED_BODY()
+
+public:
+    virtual void InitConnection(UNetDriver* InDriver, EConnectionState InState, const FURL& InURL, int32 InConnectionSpeed = 0, int32 InMaxPacket = 0) override;
+    virtual void LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
+    virtual FString LowLevelGetRemoteAddress(bool bAppendPort = false) override;
+    virtual FString LowLevelDescribe() override;
+
+    /** Client number shown in logs */
+    int32 BotIndex = INDEX_NONE;
+
+    int64 BytesSent = 0;
+    int64 PacketsSent = 0;
+
+    /**
+     * Delivers a server RPC from this bot the way an incoming bunch would: the parameters are
+     * written and read back through the function's net serialization, then the RPC is called,
+     * validation included. Returns the parameter payload in bytes, or INDEX_NONE if the actor
+     * has no channel on this connection yet.
+     */
+    int64 ReceiveServerRPC(AActor* Actor, UFunction* Function, void* Parms);
+
+    /** RPCs the server called on actors owned by this connection */
+    int64 RPCsSent = 0;
+};
+
+/**
+ * @brief Socketless server net driver whose clients are ULoadTestNetConnections.
+ *
+ * Installed as the game net driver by UInventoryLoadTestCommandlet only.
+ */
+UCLASS(Transient)
+class SURVIVALGAME_API ULoadTestNetDriver : public UNetDriver
+{
+    GENERATED_BODY()
+
+public:
+    ULoadTestNetDriver();
+
+    virtual bool IsAvailable() const override { return true; }
+    virtual bool InitConnect(FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error) override;
+    virtual bool InitListen(FNetworkNotify* InNotify, FURL& LocalURL, bool bReuseAddressAndPort, FString& Error) override;
+    virtual void LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
+    virtual FString LowLevelGetNetworkNumber() override;
+    virtual ISocketSubsystem* GetSocketSubsystem() override { return nullptr; }
+    virtual bool IsNetResourceValid() override { return true; }
+
+    /** Counts RPCs per connection before sending them as usual */
+    virtual void ProcessRemoteFunction(AActor* Actor, UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack, UObject* SubObject = nullptr) override;
+
+    /** Opens a simulated client connection, ready for a player controller */
+    ULoadTestNetConnection* AddBotConnection(int32 BotIndex);
+
+    /** Multicast RPCs, which don't belong to one connection */
+    int64 MulticastRPCs = 0;
+};
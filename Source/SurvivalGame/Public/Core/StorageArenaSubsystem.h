@@ -0,0 +1,112 @@
+// StorageArenaSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Inventory/ItemSlotStore.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StorageArenaSubsystem.generated.h"
+
+/**
+ * @brief Lightweight reference to a container whose slots live in UStorageArenaSubsystem.
+ *
+ * A handle becomes stale when its container is released; the generation check makes every
+ * arena call on a stale handle fail instead of touching the slots of a reused block.
+ */
+USTRUCT(BlueprintType)
+struct SURVIVALGAME_API FStorageHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 BlockIndex = INDEX_NONE;
+
+    UPROPERTY()
+    uint32 Generation = 0;
+
+    bool IsSet() const { return BlockIndex != INDEX_NONE; }
+
+    bool operator==(const FStorageHandle& Other) const
+    {
+        return BlockIndex == Other.BlockIndex && Generation == Other.Generation;
+    }
+};
+
+/**
+ * @brief Owns the slots of many storage containers in one pooled structure-of-arrays arena.
+ *
+ * Each container is a contiguous block of slots in a shared FItemSlotStore, identified by an
+ * FStorageHandle. Released blocks are pooled by slot count and reused by the next container
+ * of the same size, which is the common case for chests. Chests built this way need no
+ * replicated component, no per-chest slot allocation and no UObject per slot array. A
+ * UStorageFacadeComponent forwards to the arena, and contents are copied into a live
+ * UItemContainerBase only while someone actually has the chest open.
+ *
+ * The arena is memory only and is emptied with the world. Chest persistence belongs to
+ * UStorageSubsystem: chests whose contents must survive a restart are UStorageContainers.
+ * Facade chests are transient unless their owner stores WriteSnapshot in its own save data.
+ */
+UCLASS()
+class SURVIVALGAME_API UStorageArenaSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+
+    /** Reserves NumSlots empty slots for a new container */
+    FStorageHandle AllocateContainer(int32 NumSlots);
+
+    /** Clears the container's slots and returns its block to the pool */
+    void ReleaseContainer(FStorageHandle& Handle);
+
+    bool IsValidHandle(const FStorageHandle& Handle) const;
+
+    int32 GetNumSlots(const FStorageHandle& Handle) const;
+
+    FItemStructure GetItem(const FStorageHandle& Handle, int32 SlotIndex) const;
+
+    bool SetItem(const FStorageHandle& Handle, int32 SlotIndex, const FItemStructure& Item);
+
+    /**
+     * Merges into partial stacks, then fills empty slots the way UItemContainerBase::AddItem does.
+     * Returns the quantity that did not fit.
+     */
+    int32 AddItem(const FStorageHandle& Handle, const FItemStructure& Item);
+
+    /** Total quantity of an item in the container */
+    int32 CountOf(const FStorageHandle& Handle, FName RegistryKey) const;
+
+    /** Container snapshot of the block (see FItemContainerSnapshot) */
+    bool WriteSnapshot(const FStorageHandle& Handle, TArray<uint8>& OutBytes) const;
+
+    /** Replaces the block's contents with a snapshot; fails without changes if it doesn't fit */
+    bool ReadSnapshot(const FStorageHandle& Handle, TConstArrayView<uint8> Bytes);
+
+    int32 GetNumContainers() const { return Blocks.Num() - FreeBlocks.Num(); }
+    int32 GetNumArenaSlots() const { return Slots.Num(); }
+
+private:
+    struct FArenaBlock
+    {
+        int32 FirstSlot = 0;
+        int32 NumSlots = 0;
+        uint32 Generation = 0;
+        bool bInUse = false;
+    };
+
+    /** Block for a live handle, or nullptr */
+    const FArenaBlock* FindBlock(const FStorageHandle& Handle) const;
+
+    TArray<FArenaBlock> Blocks;
+
+    /** Indices of released blocks, reused before Blocks grows */
+    TArray<int32> FreeBlocks;
+
+    /** Slot count -> first slots of released ranges of exactly that size */
+    TMap<int32, TArray<int32>> FreeRangesBySize;
+
+    /** Slots of every container, block after block */
+    FItemSlotStore Slots;
+};
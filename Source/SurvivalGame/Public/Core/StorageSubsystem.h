@@ -0,0 +1,116 @@
+// StorageSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StorageSubsystem.generated.h"
+
+class UStorageContainer;
+
+/**
+ * @brief Server-side pager for world storage containers.
+ *
+ * Every UStorageContainer registers here by StorageId, but only chests that were opened or
+ * touched through EnsureResident hold live slots. A chest that stays idle for IdleSeconds is
+ * paged out into a container snapshot (FItemContainerSnapshot) and its slots are freed.
+ * Changed chests are written to Saved/Storage on a worker thread, both when they page out and
+ * periodically while they stay resident. Once a paged-out snapshot is safely on disk, its
+ * memory copy is dropped unless bKeepSnapshotsInMemory is set. The next access reads it back.
+ */
+UCLASS(Config = Game)
+class SURVIVALGAME_API UStorageSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+    /** The load-test commandlet deletes the chest files it created */
+    friend struct FInventoryLoadTestAccess;
+
+    /** Checks the files of chests that failed to restore */
+    friend class FStorageSubsystemRestoreFailureTest;
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Seconds without access before a resident chest is paged out */
+    UPROPERTY(Config)
+    float IdleSeconds = 120.0f;
+
+    /** Seconds between write-backs of chests that stay resident and keep changing */
+    UPROPERTY(Config)
+    float WriteBackInterval = 30.0f;
+
+    /** How often resident chests are checked for idling and pending writes are collected */
+    UPROPERTY(Config)
+    float CheckInterval = 5.0f;
+
+    /** Keep paged-out snapshots in memory even after they were written to disk */
+    UPROPERTY(Config)
+    bool bKeepSnapshotsInMemory = false;
+
+    /** Called by storage containers when they initialize and when they leave play */
+    void RegisterStorage(UStorageContainer* Container);
+    void UnregisterStorage(UStorageContainer* Container);
+
+    /** Makes a chest resident (loading it from memory or disk if needed) and resets its idle timer */
+    bool AcquireStorage(UStorageContainer* Container);
+
+    /** Records a change to a resident chest so it gets written back */
+    void MarkStorageDirty(UStorageContainer* Container);
+
+    int32 GetNumRegistered() const { return Records.Num(); }
+    int32 GetNumResident() const;
+
+private:
+    struct FStorageRecord
+    {
+        TWeakObjectPtr<UStorageContainer> Container;
+
+        /** Paged-out contents; empty while resident or once only the disk copy is kept */
+        TArray<uint8> Snapshot;
+
+        double LastAccessTime = 0.0;
+        double LastWriteTime = 0.0;
+
+        /** Bumped on every change; the disk copy is current when SavedRevision matches */
+        uint32 Revision = 0;
+        uint32 SavedRevision = 0;
+
+        bool bWriteInFlight = false;
+
+        /** Set when the chest could not be read or restored; it is not retried, nor written, this session */
+        bool bRestoreFailed = false;
+    };
+
+    struct FPendingWrite
+    {
+        FGuid StorageId;
+        uint32 Revision = 0;
+        TFuture<bool> Result;
+    };
+
+    /** Pages out one resident chest and queues its write if it changed */
+    void PageOut(const FGuid& StorageId, FStorageRecord& Record);
+
+    /** Starts an async write of Bytes for a chest at its current revision */
+    void QueueWrite(const FGuid& StorageId, FStorageRecord& Record, TArray<uint8> Bytes);
+
+    /** Applies finished writes; blocks on the outstanding ones when bWait is set */
+    void CollectWrites(bool bWait);
+
+    /** Pages out idle chests and writes back busy ones */
+    void CheckResidentStorage();
+
+    static FString GetStoragePath(const FGuid& StorageId);
+
+    double GetNow() const;
+
+    TMap<FGuid, FStorageRecord> Records;
+    TArray<FPendingWrite> PendingWrites;
+
+    float TimeUntilCheck = 0.0f;
+};
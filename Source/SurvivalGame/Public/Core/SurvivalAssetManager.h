@@ -4,8 +4,30 @@
 
 #include "CoreMinimal.h"
 #include "Engine/AssetManager.h"
+#include "Enums/ItemEnums.h"
 #include "SurvivalAssetManager.generated.h"
 
+/**
+ * An item found by the asset scan, described by metadata only.
+ * Definition fields come from the item's searchable asset registry tags (or the asset itself
+ * when it already happens to be loaded), so systems like sorting never have to load an item.
+ */
+struct FItemIndexEntry
+{
+	FName RegistryKey;
+	FSoftObjectPath AssetPath;
+
+	E_ItemCategory ItemCategory = E_ItemCategory::None;
+	E_ItemType ItemType = E_ItemType::None;
+	E_ItemRarity ItemRarity = E_ItemRarity::None;
+	int32 StackSize = 1;
+	float ItemWeight = 0.0f;
+	FText ItemName;
+
+	/** Position of ItemName in alphabetical order across all indexed items */
+	int32 NameOrdinal = 0;
+};
+
 /**
  * Custom Asset Manager for Survival Game.
  */
@@ -15,10 +37,62 @@ class SURVIVALGAME_API USurvivalAssetManager : public UAssetManager
 	GENERATED_BODY()
 
 public:
+	/** Returns the project asset manager, or nullptr before the engine created it. */
+	static USurvivalAssetManager* GetIfValid();
+
 	/** Called at startup to allow scanning/initialization logic. */
 	virtual void StartInitialLoading() override;
 
+	/**
+	 * Item index: every scanned "Item" asset keyed by its RegistryKey, built once from asset
+	 * registry metadata so no item has to be loaded to resolve a key. Entries are kept in lexical
+	 * key order; an entry's position is its net index. Server and client must have the same
+	 * index for net indices to mean the same item, so its checksum is part of the network
+	 * version and the engine refuses a client whose index differs when it connects.
+	 */
+
+	/** Asset path for a registry key, or a null path if no scanned item uses that key. */
+	FSoftObjectPath FindItemAssetPath(FName RegistryKey) const;
+
+	/** Net index of an item definition, or INDEX_NONE if the key wasn't found by the scan. */
+	int32 GetItemNetIndex(FName RegistryKey) const;
+
+	/** Resolves a net index back to its registry key and item asset path. */
+	bool GetItemFromNetIndex(int32 NetIndex, FName& OutRegistryKey, FSoftObjectPath& OutAssetPath) const;
+
+	/** All indexed items in net index order */
+	const TArray<FItemIndexEntry>& GetItemIndex() const;
+
+	/** Indexed item for a net index, or nullptr */
+	const FItemIndexEntry* GetItemIndexEntry(int32 NetIndex) const;
+
+	/** Checksum of the index contents, mixed into the network version */
+	uint32 GetItemIndexChecksum() const { return ItemIndexChecksum; }
+
 private:
 	/** Callback after async load finishes. */
 	void OnItemsLoaded() const;
+
+	/** Builds the item index from the asset data of the primary assets found by the scan. */
+	void BuildItemIndex();
+
+	/** Fills an entry's definition fields from searchable tags without loading the item. */
+	static void ReadItemDefinition(const FAssetData& AssetData, FItemIndexEntry& Entry);
+
+	/** Numbers entries by display name so name sorting is a plain integer compare. */
+	void AssignNameOrdinals();
+
+	/** Builds the index on first use if it was queried before the scan finished. */
+	void EnsureItemIndex() const;
+
+	/** Network version override: the engine's own version combined with ItemIndexChecksum */
+	uint32 GetNetworkVersion() const;
+
+	/** Net index -> item */
+	TArray<FItemIndexEntry> ItemIndexEntries;
+
+	/** Registry key -> net index */
+	TMap<FName, int32> ItemIndexByKey;
+
+	uint32 ItemIndexChecksum = 0;
 };
@@ -0,0 +1,61 @@
+// SurvivalLog.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Compile-time verbosity cap for the survival log categories.
+ * Shipping keeps only warnings and errors, Test keeps Log, every other configuration keeps everything.
+ * UE_LOG only formats its arguments when the category is active, so capped or runtime-suppressed
+ * messages never pay for FName::ToString() or path formatting.
+ */
+#if UE_BUILD_SHIPPING
+    #define SURVIVAL_LOG_COMPILETIME_VERBOSITY Warning
+#elif UE_BUILD_TEST
+    #define SURVIVAL_LOG_COMPILETIME_VERBOSITY Log
+#else
+    #define SURVIVAL_LOG_COMPILETIME_VERBOSITY All
+#endif
+
+/** Container and slot operations */
+SURVIVALGAME_API DECLARE_LOG_CATEGORY_EXTERN(LogInventory, Log, SURVIVAL_LOG_COMPILETIME_VERBOSITY);
+
+/** Inventory widgets and the controller code that drives them */
+SURVIVALGAME_API DECLARE_LOG_CATEGORY_EXTERN(LogInventoryUI, Log, SURVIVAL_LOG_COMPILETIME_VERBOSITY);
+
+/** Item asset scanning, indexing and resolving */
+SURVIVALGAME_API DECLARE_LOG_CATEGORY_EXTERN(LogItemAssets, Log, SURVIVAL_LOG_COMPILETIME_VERBOSITY);
+
+/**
+ * UE_LOG that prints at most once every IntervalSeconds per call site, for messages that can fire
+ * once per slot or once per frame. The number of skipped messages is reported with the next one.
+ * Call sites keep their own static state, so use this from the game thread only.
+ *
+ *   SURVIVAL_LOG_RATELIMITED(LogInventory, Warning, 1.0, TEXT("Invalid index %d"), Index);
+ */
+#define SURVIVAL_LOG_RATELIMITED(CategoryName, Verbosity, IntervalSeconds, Format, ...) \
+    do \
+    { \
+        if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+        { \
+            static double SurvivalLogLastTime = -DBL_MAX; \
+            static int32 SurvivalLogSkipped = 0; \
+            const double SurvivalLogNow = FPlatformTime::Seconds(); \
+            if (SurvivalLogNow - SurvivalLogLastTime >= (IntervalSeconds)) \
+            { \
+                UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+                if (SurvivalLogSkipped > 0) \
+                { \
+                    UE_LOG(CategoryName, Verbosity, TEXT("  (%d similar messages skipped)"), SurvivalLogSkipped); \
+                } \
+                SurvivalLogLastTime = SurvivalLogNow; \
+                SurvivalLogSkipped = 0; \
+            } \
+            else \
+            { \
+                ++SurvivalLogSkipped; \
+            } \
+        } \
+    } while (0)
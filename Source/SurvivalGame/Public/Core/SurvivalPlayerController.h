@@ -3,11 +3,11 @@
 #include "CoreMinimal.h"
 #include "Enums/ContainerType.h"
 #include "Data/Struct/ItemStructure.h"
+#include "Components/Inventory/SlotMovePrediction.h"
 #include "GameFramework/PlayerController.h"
 #include "UI/Widgets/DefaultHUDLayout.h"
 #include "InputMappingContext.h"
 #include "Engine/AssetManager.h"
-#include "Engine/ObjectLibrary.h"
 #include "PrimaryData/ItemInfo.h"
 #include "UObject/SoftObjectPtr.h"
 #include "SurvivalGame/Public/Interfaces/ControllerInterface.h"
@@ -17,9 +17,42 @@ class UInputAction;
 class UMasterUILayout;
 class UGameInventoryLayout;
 class UInventorySlot;
+class UItemContainerBase;
 
 #include "SurvivalPlayerController.generated.h"
 
+/**
+ * @brief Every slot of one container that changed during a frame
+ */
+USTRUCT()
+struct FContainerSlotUpdates
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    E_ContainerType ContainerType = E_ContainerType::None;
+
+    /** Final contents per slot; an empty item clears the slot */
+    UPROPERTY()
+    TArray<FItemSlotUpdate> Updates;
+};
+
+/**
+ * @brief Server answer to the client's predicted slot moves, sent along with the slot changes they caused
+ */
+USTRUCT()
+struct FSlotMoveAck
+{
+    GENERATED_BODY()
+
+    /** Every predicted move with a key up to this one has been executed or rejected */
+    UPROPERTY()
+    int32 LastProcessedKey = 0;
+
+    UPROPERTY()
+    TArray<int32> RejectedKeys;
+};
+
 /**
  * @brief Player controller for the survival game.
  * Handles inventory toggling and implements the CloseInventory function via the ControllerInterface.
@@ -36,6 +69,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Debug")
     void DebugListAllItemAssets();
 
+    /** Subscribes this player to a container's contents, e.g. when a chest UI opens */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void OpenContainer(UItemContainerBase* Container);
+
+    /** Ends the subscription; the contents stop replicating to this player */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void CloseContainer(UItemContainerBase* Container);
+
+    /** Most recently opened container of a type this player still has open. Server and owning client. */
+    UItemContainerBase* FindOpenContainer(E_ContainerType ContainerType) const;
+
+    /**
+     * Shows a move the owning client is about to send as if it had already happened.
+     * Returns the prediction key to send with the command, or 0 if it couldn't be predicted.
+     */
+    int32 PredictSlotMove(const FSlotMoveCommand& Command, const UItemContainerBase* FromContainer, const UItemContainerBase* ToContainer);
+
+    /** Answers a predicted move; sent with the next slot update flush. Server only. */
+    void AcknowledgeSlotMove(int32 PredictionKey, bool bAccepted);
+
 protected:
     virtual void BeginPlay() override;
     virtual void SetupInputComponent() override;
@@ -87,20 +140,65 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     UInventorySlot* GetInventorySlotWidget(E_ContainerType ContainerType, int32 SlotIndex);
     
-    UFUNCTION(Client, Reliable, Category = "Inventory")
-    void Client_UpdateSlot(E_ContainerType Container, FItemStructure ItemInfo, int32 Index);
-    
+    /** Slot interface calls only queue into the outbox; the client gets everything in one RPC per frame */
     virtual void UpdateItemSlot_Implementation(E_ContainerType ContainerType, FItemStructure ItemInfo, int32 Index) override;
+    virtual void UpdateItemSlots_Implementation(E_ContainerType ContainerType, const TArray<FItemSlotUpdate>& SlotUpdates) override;
+    virtual void ResetItemSlot_Implementation(E_ContainerType ContainerType, int32 Index) override;
+
+    UFUNCTION(Server, Reliable)
+    void Server_OpenContainer(UItemContainerBase* Container);
+
+    UFUNCTION(Server, Reliable)
+    void Server_CloseContainer(UItemContainerBase* Container);
 
+    /** Containers opened through OpenContainer, oldest first; move commands resolve against these */
+    TArray<TWeakObjectPtr<UItemContainerBase>> OpenContainers;
 
+    /** Farthest a pawn can be from a container it opens; 0 disables the check */
+    UPROPERTY(EditDefaultsOnly, Category = "Inventory")
+    float MaxContainerViewDistance = 600.0f;
+
+    /** Applies a frame's worth of slot changes to the inventory widgets, then reconciles predicted moves */
     UFUNCTION(Client, Reliable, Category = "Inventory")
-    void Client_ResetSlot(E_ContainerType Container, int32 Index);
-    virtual void ResetItemSlot_Implementation(E_ContainerType ContainerType, int32 Index) override;
+    void Client_ApplySlotUpdates(const TArray<FContainerSlotUpdates>& ContainerUpdates, const FSlotMoveAck& MoveAck);
     
+
 private:
     /** Helper function to initialize our CommonUI-enhanced input mappings. */
     void InitializeEnhancedInput() const;
 
     /** Helper function to create and add our Master UI Layout widget. */
     void CreateMasterLayout();
+
+    /** Queues a slot's latest contents; a later write to the same slot in the same frame replaces it */
+    void QueueSlotUpdate(E_ContainerType ContainerType, int32 SlotIndex, const FItemStructure& Item);
+
+    /** Sends everything queued this frame, and any move acks, as a single Client_ApplySlotUpdates */
+    void FlushSlotOutbox();
+
+    /** Binds FlushSlotOutbox to the end of this frame */
+    void ScheduleSlotOutboxFlush();
+
+    /** Shows an item in a slot widget */
+    void DisplaySlot(E_ContainerType ContainerType, int32 SlotIndex, const FItemStructure& Item);
+
+    void DisplayPredictionChanges(TConstArrayView<FSlotMovePrediction::FDisplayChange> Changes);
+
+    void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+    /** Pending slot changes, one entry per container type touched this frame */
+    TArray<FContainerSlotUpdates> SlotOutbox;
+
+    /** Container type -> slot index -> position in that container's Updates */
+    TMap<E_ContainerType, TMap<int32, int32>> SlotOutboxLookup;
+
+    /** Bound only while the outbox has something to send */
+    FDelegateHandle SlotOutboxFlushHandle;
+
+    /** Server: move acks waiting for the next flush */
+    FSlotMoveAck PendingMoveAck;
+    bool bMoveAckPending = false;
+
+    /** Client: moves shown before the server confirmed them */
+    FSlotMovePrediction MovePrediction;
 };
\ No newline at end of file
@@ -40,22 +40,23 @@ public:
 	bool LoadFromDataTable(const UDataTable* DataTable);
 
     /** Core Properties */
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core")
+    /** Searchable so USurvivalAssetManager can index items without loading them */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core", AssetRegistrySearchable)
     FName RegistryKey;
 
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core", meta = (AllowedClasses = "/Script/Engine.Texture2D"))
     TSoftObjectPtr<UTexture2D> ItemIcon;
 
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core")
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core", AssetRegistrySearchable)
     FText ItemName;
 
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core", meta = (MultiLine = true))
     FText ItemDescription;
 
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core")
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core", AssetRegistrySearchable)
     E_ItemCategory ItemCategory;
 
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core")
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Core", AssetRegistrySearchable)
     E_ItemType ItemType;
 
     /** Additional Properties */
@@ -64,15 +65,15 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats", meta = (EditCondition = "bShowDamage", EditConditionHides))
     int32 ItemDamage;
 
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats")
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats", AssetRegistrySearchable)
     E_ItemRarity ItemRarity;
 
     // Stackable flag; used directly for showing the StackSize property.
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats")
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats", AssetRegistrySearchable)
     bool bStackable;
 
     // StackSize is only shown when bStackable is true.
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats", meta = (EditCondition = "bStackable", EditConditionHides))
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats", AssetRegistrySearchable, meta = (EditCondition = "bStackable", EditConditionHides))
     int32 StackSize;
 
     // Soft class reference for the item master class
@@ -102,7 +103,7 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats")
     int32 ItemCurHP;
 
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats")
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Stats", AssetRegistrySearchable)
     float ItemWeight;
 
     /** Type Specific Properties */
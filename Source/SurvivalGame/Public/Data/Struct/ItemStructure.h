@@ -49,4 +49,36 @@ struct SURVIVALGAME_API FItemStructure : public FTableRowBase
 
     /** Basic utility function */
     bool IsEmpty() const { return RegistryKey.IsNone(); }
+
+    /**
+     * Compact replication used by slot replication and slot RPCs.
+     * The definition travels as a net index from USurvivalAssetManager and ItemAsset is rebuilt
+     * from it on receive; fields at their default values are skipped, counts are packed and
+     * CurrentHP is sent as a quantized fraction of MaxHP.
+     */
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FItemStructure> : public TStructOpsTypeTraitsBase2<FItemStructure>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
+
+/**
+ * @brief A single slot's new contents, used to send several slot changes in one call
+ */
+USTRUCT(BlueprintType)
+struct SURVIVALGAME_API FItemSlotUpdate
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core")
+    int32 SlotIndex = INDEX_NONE;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core")
+    FItemStructure Item;
 };
\ No newline at end of file
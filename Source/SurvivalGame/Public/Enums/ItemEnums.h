@@ -187,7 +187,8 @@ enum class E_SortMethod : uint8
     Name        UMETA(DisplayName = "Name"),
     Type        UMETA(DisplayName = "Type"),
     Rarity      UMETA(DisplayName = "Rarity"),
-    Value       UMETA(DisplayName = "Value"),
+    /** Unsupported: items have no value yet. Kept so saved values keep their meaning. */
+    Value       UMETA(DisplayName = "Value", Hidden),
     Weight      UMETA(DisplayName = "Weight")
 };
 
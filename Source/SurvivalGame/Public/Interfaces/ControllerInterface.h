@@ -26,6 +26,9 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Inventory")
 	void UpdateItemSlot(E_ContainerType ContainerType, FItemStructure ItemInfo, int32 Index);
 
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Inventory")
+	void UpdateItemSlots(E_ContainerType ContainerType, const TArray<FItemSlotUpdate>& SlotUpdates);
+
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Inventory")
 	void ResetItemSlot(E_ContainerType ContainerType, int32 Index);
 	
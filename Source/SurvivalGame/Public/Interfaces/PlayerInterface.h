@@ -27,6 +27,16 @@ public:
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Inventory")
 	void UpdateItem(E_ContainerType ContainerType, int32 Index, FItemStructure ItemInfo);
+
+	/**
+	 * Updates several slots of a container at once.
+	 * Used by batched container operations so the whole change set reaches the UI in one call.
+	 *
+	 * @param ContainerType The type of container the slots belong to.
+	 * @param SlotUpdates The new contents of every changed slot.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Inventory")
+	void UpdateItems(E_ContainerType ContainerType, const TArray<FItemSlotUpdate>& SlotUpdates);
 	
 
 	/**
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "CommonUserWidget.h"
+#include "Core/SurvivalLog.h"
 #include "InventorySlot.h"
 #include "Enums/ContainerType.h"  // Ensure this is the correct path for your enum
 #include "ItemContainerGrid.generated.h"
@@ -38,12 +39,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Debug")
     void DebugSlotConfiguration()
     {
-        UE_LOG(LogTemp, Log, TEXT("ItemContainerGrid Debug:"));
-        UE_LOG(LogTemp, Log, TEXT("SlotsPerRow: %d"), SlotsPerRow);
-        UE_LOG(LogTemp, Log, TEXT("TotalSlots: %d"), TotalSlots);
-        UE_LOG(LogTemp, Log, TEXT("Grid Valid: %s"), Grid ? TEXT("True") : TEXT("False"));
-        UE_LOG(LogTemp, Log, TEXT("InventorySlotClass Valid: %s"), InventorySlotClass ? TEXT("True") : TEXT("False"));
-        UE_LOG(LogTemp, Log, TEXT("Current Slots Count: %d"), Slots.Num());
+        UE_LOG(LogInventoryUI, Log, TEXT("ItemContainerGrid Debug:"));
+        UE_LOG(LogInventoryUI, Log, TEXT("SlotsPerRow: %d"), SlotsPerRow);
+        UE_LOG(LogInventoryUI, Log, TEXT("TotalSlots: %d"), TotalSlots);
+        UE_LOG(LogInventoryUI, Log, TEXT("Grid Valid: %s"), Grid ? TEXT("True") : TEXT("False"));
+        UE_LOG(LogInventoryUI, Log, TEXT("InventorySlotClass Valid: %s"), InventorySlotClass ? TEXT("True") : TEXT("False"));
+        UE_LOG(LogInventoryUI, Log, TEXT("Current Slots Count: %d"), Slots.Num());
     }
 
     /** Number of inventory slots per row. */
@@ -55,13 +55,13 @@ public class SurvivalGame : ModuleRules
             "UMG",
             "Slate",
             "SlateCore",
-            "CommonInput"
+            "CommonInput",
+            "NetCore"
         });
 
         // Private dependencies for low-level or engine-specific functionalities
         PrivateDependencyModuleNames.AddRange(new[]
         {
-            "NetCore",
             "RenderCore",
             "DeveloperSettings",
             "PhysicsCore",